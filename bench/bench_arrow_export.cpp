@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// Direct columnar export vs tokenize() followed by a copy into columns
+
+#include <iomanip>
+#include "bench_common.hpp"
+#include "arrow_export.hpp"
+
+using namespace db25;
+
+int main(int argc, char* argv[]) {
+    std::string corpus = bench::load_file(argc > 1 ? argv[1] : bench::DEFAULT_CORPUS);
+    if (corpus.empty()) {
+        return 1;
+    }
+    std::string input = bench::replicate(corpus, 8 << 20);
+    const auto* data = reinterpret_cast<const std::byte*>(input.data());
+    constexpr int iterations = 5;
+
+    size_t tokens = 0;
+    double direct_ns = bench::best_time_ns(iterations, [&] {
+        ArrowArray array;
+        tokens = export_tokens_arrow(data, input.size(), &array);
+        bench::do_not_optimize(array.children);
+        array.release(&array);
+    });
+
+    double copy_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        auto all = tokenizer.tokenize();
+        std::vector<uint8_t> type(all.size());
+        std::vector<uint16_t> keyword_id(all.size());
+        std::vector<uint64_t> offset(all.size());
+        std::vector<uint32_t> length(all.size());
+        std::vector<uint32_t> line(all.size());
+        std::vector<uint32_t> statement(all.size());
+        uint32_t current = 0;
+        for (size_t i = 0; i < all.size(); ++i) {
+            type[i] = static_cast<uint8_t>(all[i].type);
+            keyword_id[i] = static_cast<uint16_t>(all[i].keyword_id);
+            offset[i] = static_cast<uint64_t>(all[i].value.data() - input.data());
+            length[i] = static_cast<uint32_t>(all[i].value.size());
+            line[i] = all[i].line;
+            statement[i] = current;
+            current += all[i].operator_kind() == OperatorKind::Semicolon;
+        }
+        bench::do_not_optimize(statement.data());
+    });
+
+    auto mb_per_s = [&](double ns) { return input.size() / (ns / 1e9) / (1024.0 * 1024.0); };
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Arrow Columnar Export (" << input.size() / (1024 * 1024) << " MB, " << tokens << " tokens)\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::left << std::setw(28) << "tokenize() + copy" << std::right
+              << std::setw(10) << copy_ns / 1e6 << " ms" << std::setw(10) << mb_per_s(copy_ns) << " MB/s\n";
+    std::cout << std::left << std::setw(28) << "export_tokens_arrow()" << std::right
+              << std::setw(10) << direct_ns / 1e6 << " ms" << std::setw(10) << mb_per_s(direct_ns) << " MB/s"
+              << std::setw(10) << copy_ns / direct_ns << "x\n";
+    std::cout << "Bytes per token: " << 32 + 23 << " (vector + columns) vs 23 (columns)\n";
+    return 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// Files/s and MB/s for bulk ingestion of many small SQL files,
+// io_uring vs blocking open/read/close
+
+#include <iomanip>
+#include "bench_common.hpp"
+#include "bulk_ingest.hpp"
+
+using namespace db25;
+
+int main(int argc, char* argv[]) {
+    std::string corpus = bench::load_file(argc > 1 ? argv[1] : bench::DEFAULT_CORPUS);
+    size_t file_count = argc > 2 ? std::stoul(argv[2]) : 10000;
+    if (corpus.empty()) {
+        return 1;
+    }
+
+    // Split the corpus into one small file per statement-sized chunk
+    auto dir = std::filesystem::temp_directory_path() / "db25_bench_ingest";
+    std::filesystem::create_directories(dir);
+    std::vector<std::filesystem::path> paths;
+    for (size_t i = 0; i < file_count; ++i) {
+        size_t offset = (i * 997) % corpus.size();
+        size_t length = std::min<size_t>(2048, corpus.size() - offset);
+        auto path = dir / (std::to_string(i) + ".sql");
+        std::ofstream(path, std::ios::binary).write(corpus.data() + offset, length);
+        paths.push_back(path);
+    }
+
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Bulk Ingestion (" << file_count << " files)\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "io_uring available: " << (io_uring_available() ? "yes" : "no") << "\n\n";
+
+    for (bool uring : {false, true}) {
+        IngestOptions options;
+        options.use_io_uring = uring;
+        auto stats = ingest_files(paths, [](const IngestedFile& file) {
+            bench::do_not_optimize(file.tokens.size());
+        }, options);
+
+        std::cout << std::setw(10) << std::left << (stats.used_io_uring ? "io_uring" : "blocking")
+                  << std::fixed << std::setprecision(0) << std::right
+                  << std::setw(10) << stats.files_per_second() << " files/s  "
+                  << std::setprecision(1) << std::setw(8) << stats.mb_per_second() << " MB/s  "
+                  << stats.tokens << " tokens\n";
+    }
+
+    std::filesystem::remove_all(dir);
+    return 0;
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Shared helpers for the benchmark programs in bench/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace db25::bench {
+
+// Default corpus: the SQL test suite, copied next to the binaries by CMake
+inline constexpr const char* DEFAULT_CORPUS = "test/sql_test.sqls";
+
+inline std::string load_file(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::cerr << "Error: Cannot open file: " << path << "\n";
+        return {};
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// Repeats `text` until the result is at least `min_bytes` long
+inline std::string replicate(const std::string& text, size_t min_bytes) {
+    std::string out;
+    if (text.empty()) return out;
+    out.reserve(min_bytes + text.size());
+    while (out.size() < min_bytes) {
+        out += text;
+        out += '\n';
+    }
+    return out;
+}
+
+// Runs `body` `iterations` times and returns the best wall time in nanoseconds
+template<typename Body>
+double best_time_ns(int iterations, Body&& body) {
+    double best = 1e300;
+    for (int i = 0; i < iterations; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count());
+    }
+    return best;
+}
+
+// Prevents the optimizer from discarding a computed value
+template<typename T>
+inline void do_not_optimize(const T& value) {
+#ifdef __GNUC__
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+}  // namespace db25::bench
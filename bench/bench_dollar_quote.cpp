@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// Migrations with long PL/pgSQL bodies: bodies lexed as top-level SQL vs
+// DollarString tokens, and the cost of lexing every body on demand.
+//
+// Usage: bench_dollar_quote [input MB, default 32]
+
+#include <cstdlib>
+#include <iomanip>
+#include <string>
+#include "bench_common.hpp"
+#include "dollar_quote.hpp"
+#include "statement_splitter.hpp"
+
+using namespace db25;
+
+namespace {
+
+std::string make_migration(size_t min_bytes) {
+    std::string sql;
+    for (int fn = 0; sql.size() < min_bytes; ++fn) {
+        std::string name = "audit_" + std::to_string(fn);
+        sql += "CREATE TABLE " + name + " (id bigint PRIMARY KEY, payload jsonb, created timestamptz);\n";
+        sql += "CREATE OR REPLACE FUNCTION " + name + "_fn(p_id bigint) RETURNS void AS $fn$\n"
+               "DECLARE\n    v_count integer := 0;\nBEGIN\n";
+        for (int line = 0; line < 400; ++line) {
+            sql += "    IF p_id % " + std::to_string(line + 2) + " = 0 THEN\n"
+                   "        UPDATE " + name + " SET payload = payload || '{\"step\": " + std::to_string(line) +
+                   "}' WHERE id = p_id;\n"
+                   "        v_count := v_count + 1;  -- step " + std::to_string(line) + "\n"
+                   "    END IF;\n";
+        }
+        sql += "    EXECUTE $q$ANALYZE " + name + "$q$;\nEND;\n$fn$ LANGUAGE plpgsql;\n\n";
+    }
+    return sql;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    size_t megabytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 32;
+    if (megabytes == 0) {
+        megabytes = 32;
+    }
+    std::string input = make_migration(megabytes << 20);
+    const auto* data = reinterpret_cast<const std::byte*>(input.data());
+    constexpr int iterations = 5;
+
+    size_t plain_tokens = 0;
+    double plain_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        auto tokens = tokenizer.tokenize();
+        plain_tokens = tokens.size();
+        bench::do_not_optimize(tokens.data());
+    });
+
+    size_t quoted_tokens = 0;
+    double quoted_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        tokenizer.set_dollar_quotes(true);
+        auto tokens = tokenizer.tokenize();
+        quoted_tokens = tokens.size();
+        bench::do_not_optimize(tokens.data());
+    });
+
+    size_t inner_tokens = 0;
+    double inner_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        tokenizer.set_dollar_quotes(true);
+        auto tokens = tokenizer.tokenize();
+        inner_tokens = 0;
+        for (const Token& token : tokens) {
+            if (token.type == TokenType::DollarString) {
+                inner_tokens += DollarBodyTokenizer(token).tokenize().size();
+            }
+        }
+        bench::do_not_optimize(inner_tokens);
+    });
+
+    StatementSplitter plain_splitter;
+    StatementSplitter quote_splitter;
+    quote_splitter.set_dollar_quotes(true);
+    size_t plain_statements = 0;
+    size_t quoted_statements = 0;
+    double split_plain_ns = bench::best_time_ns(iterations, [&] {
+        plain_statements = plain_splitter.find_boundaries(data, input.size()).size();
+    });
+    double split_quoted_ns = bench::best_time_ns(iterations, [&] {
+        quoted_statements = quote_splitter.find_boundaries(data, input.size()).size();
+    });
+
+    auto mb_per_s = [&](double ns) { return input.size() / (ns / 1e9) / (1024.0 * 1024.0); };
+    auto row = [&](const char* name, double ns, size_t count, const char* unit) {
+        std::cout << std::left << std::setw(34) << name << std::right
+                  << std::setw(10) << ns / 1e6 << " ms" << std::setw(10) << mb_per_s(ns) << " MB/s"
+                  << std::setw(12) << count << " " << unit << "\n";
+    };
+
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Dollar-Quoted Bodies (" << input.size() / (1024 * 1024) << " MB migration)\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+    row("bodies lexed as SQL", plain_ns, plain_tokens, "tokens");
+    row("set_dollar_quotes(true)", quoted_ns, quoted_tokens, "tokens");
+    row("  + DollarBodyTokenizer on all", inner_ns, quoted_tokens + inner_tokens, "tokens");
+    std::cout << "Speedup when bodies are not inspected: " << plain_ns / quoted_ns << "x\n\n";
+    row("StatementSplitter", split_plain_ns, plain_statements, "';' (wrong inside bodies)");
+    row("StatementSplitter + dollar quotes", split_quoted_ns, quoted_statements, "statements");
+    return 0;
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// Huge-input mode: std::vector<Token> vs HugeTokenBuffer, one technique
+// at a time (huge pages, streaming stores, input prefetch). Reports time,
+// input bandwidth, minor page faults and, where perf events are allowed,
+// dTLB load/store misses.
+//
+// Usage: bench_huge_input [corpus] [input MB, default 64]
+
+#include <iomanip>
+#include <string>
+#include "bench_common.hpp"
+#include "huge_token_buffer.hpp"
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/resource.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+using namespace db25;
+
+namespace {
+
+// One hardware cache event for this thread, user space only; -1 if unavailable
+class PerfCounter {
+private:
+    int fd_ = -1;
+
+public:
+    explicit PerfCounter(uint64_t cache_op) {
+#if defined(__linux__)
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB | (cache_op << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#else
+        (void)cache_op;
+#endif
+    }
+    ~PerfCounter() {
+#if defined(__linux__)
+        if (fd_ >= 0) ::close(fd_);
+#endif
+    }
+    PerfCounter(const PerfCounter&) = delete;
+    PerfCounter& operator=(const PerfCounter&) = delete;
+
+    void start() {
+#if defined(__linux__)
+        if (fd_ < 0) return;
+        ::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+        ::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+    }
+
+    [[nodiscard]] long long stop() {
+#if defined(__linux__)
+        if (fd_ < 0) return -1;
+        ::ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+        long long count = 0;
+        if (::read(fd_, &count, sizeof(count)) != static_cast<ssize_t>(sizeof(count))) return -1;
+        return count;
+#else
+        return -1;
+#endif
+    }
+};
+
+long minor_faults() {
+#if defined(__linux__)
+    rusage usage{};
+    ::getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_minflt;
+#else
+    return 0;
+#endif
+}
+
+struct Measurement {
+    double ns = 1e300;
+    long faults = 0;
+    long long tlb_loads = -1;
+    long long tlb_stores = -1;
+};
+
+// Best of `iterations`; faults and TLB misses are taken from the best run
+template<typename Body>
+Measurement measure(int iterations, Body&& body) {
+    PerfCounter loads(PERF_COUNT_HW_CACHE_OP_READ);
+    PerfCounter stores(PERF_COUNT_HW_CACHE_OP_WRITE);
+    Measurement best;
+    for (int i = 0; i < iterations; ++i) {
+        long faults = minor_faults();
+        loads.start();
+        stores.start();
+        auto start = std::chrono::steady_clock::now();
+        body();
+        auto end = std::chrono::steady_clock::now();
+        long long tlb_stores = stores.stop();
+        long long tlb_loads = loads.stop();
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        if (ns < best.ns) {
+            best = {ns, minor_faults() - faults, tlb_loads, tlb_stores};
+        }
+    }
+    return best;
+}
+
+std::string count_or_na(long long value) {
+    return value < 0 ? "n/a" : std::to_string(value / 1000) + "k";
+}
+
+void report(const char* name, const Measurement& m, size_t bytes, double baseline_ns) {
+    std::cout << std::left << std::setw(32) << name << std::right
+              << std::setw(9) << m.ns / 1e6 << " ms"
+              << std::setw(9) << bytes / (m.ns / 1e9) / (1024.0 * 1024.0) << " MB/s"
+              << std::setw(7) << baseline_ns / m.ns << "x"
+              << std::setw(9) << m.faults
+              << std::setw(10) << count_or_na(m.tlb_loads)
+              << std::setw(10) << count_or_na(m.tlb_stores) << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::string corpus = bench::load_file(argc > 1 ? argv[1] : bench::DEFAULT_CORPUS);
+    if (corpus.empty()) {
+        return 1;
+    }
+    size_t megabytes = argc > 2 ? std::stoul(argv[2]) : 64;
+    std::string input = bench::replicate(corpus, megabytes << 20);
+    const auto* data = reinterpret_cast<const std::byte*>(input.data());
+    constexpr int iterations = 3;
+
+    size_t tokens = 0;
+    Measurement vector_run = measure(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        auto all = tokenizer.tokenize();
+        tokens = all.size();
+        bench::do_not_optimize(all.data());
+    });
+
+    struct Variant {
+        const char* name;
+        bool huge_pages;
+        HugeBufferOptions options;
+    };
+    const Variant variants[] = {
+        {"HugeTokenBuffer (4 KiB pages)", false, {false, 0}},
+        {"+ huge pages", true, {false, 0}},
+        {"+ streaming stores", true, {true, 0}},
+        {"+ input prefetch", true, {true, 2048}},
+    };
+
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Huge-Input Mode (" << input.size() / (1024 * 1024) << " MB, " << tokens << " tokens, "
+              << tokens * sizeof(Token) / (1024 * 1024) << " MB of tokens)\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << std::left << std::setw(32) << "" << std::right << std::setw(12) << "time" << std::setw(14)
+              << "input" << std::setw(8) << "" << std::setw(9) << "faults" << std::setw(10) << "dTLB-ld"
+              << std::setw(10) << "dTLB-st" << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+    report("std::vector<Token> tokenize()", vector_run, input.size(), vector_run.ns);
+
+    for (const auto& variant : variants) {
+        Measurement run = measure(iterations, [&] {
+            HugeTokenBuffer buffer(variant.huge_pages);
+            tokenize_huge(data, input.size(), buffer, variant.options);
+            bench::do_not_optimize(buffer.tokens().data());
+        });
+        report(variant.name, run, input.size(), vector_run.ns);
+    }
+    return 0;
+}
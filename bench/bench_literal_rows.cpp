@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// Bulk-load dumps: per-value tokens vs the LiteralList fast path. Inputs
+// are synthetic multi-row INSERTs (numbers, strings, NULLs) and long IN
+// lists; reports time, bandwidth and stored bytes per value.
+//
+// Usage: bench_literal_rows [input MB, default 32]
+
+#include <cstdlib>
+#include <iomanip>
+#include <string>
+#include "bench_common.hpp"
+#include "simd_tokenizer.hpp"
+
+using namespace db25;
+
+namespace {
+
+std::string make_dump(size_t min_bytes) {
+    std::string sql;
+    size_t id = 0;
+    while (sql.size() < min_bytes) {
+        sql += "INSERT INTO orders (id, customer, note, amount, shipped) VALUES\n";
+        for (int row = 0; row < 1000; ++row, ++id) {
+            sql += row ? ",\n(" : "(";
+            sql += std::to_string(id) + ", 'customer " + std::to_string(id % 9973) + "', ";
+            sql += id % 7 == 0 ? "NULL" : "'note with ''quotes'', commas (and parens)'";
+            sql += ", " + std::to_string(id % 100000) + ".25, " + (id % 2 ? "TRUE" : "FALSE") + ")";
+        }
+        sql += ";\n";
+    }
+    return sql;
+}
+
+std::string make_in_lists(size_t min_bytes) {
+    std::string sql;
+    size_t id = 0;
+    while (sql.size() < min_bytes) {
+        sql += "SELECT * FROM orders WHERE id IN (";
+        for (int i = 0; i < 2000; ++i, ++id) {
+            sql += (i ? ", " : "") + std::to_string(id * 7919 % 10000019);
+        }
+        sql += ");\n";
+    }
+    return sql;
+}
+
+void run(const char* name, const std::string& input) {
+    const auto* data = reinterpret_cast<const std::byte*>(input.data());
+    constexpr int iterations = 5;
+
+    size_t plain_tokens = 0;
+    double plain_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        auto tokens = tokenizer.tokenize();
+        plain_tokens = tokens.size();
+        bench::do_not_optimize(tokens.data());
+    });
+
+    size_t fast_tokens = 0;
+    size_t fields = 0;
+    LiteralRowIndex index;
+    double fast_ns = bench::best_time_ns(iterations, [&] {
+        index.clear();
+        SimdTokenizer tokenizer(data, input.size());
+        tokenizer.set_literal_rows(&index);
+        auto tokens = tokenizer.tokenize();
+        fast_tokens = tokens.size();
+        fields = index.fields.size();
+        bench::do_not_optimize(tokens.data());
+    });
+
+    auto mb_per_s = [&](double ns) { return input.size() / (ns / 1e9) / (1024.0 * 1024.0); };
+    size_t fast_bytes = fast_tokens * sizeof(Token) + fields * sizeof(LiteralField) +
+                        index.lists.size() * sizeof(LiteralList);
+    std::cout << "\n" << name << " (" << input.size() / (1024 * 1024) << " MB, " << fields << " values)\n";
+    std::cout << std::string(80, '-') << "\n";
+    std::cout << std::left << std::setw(24) << "per-value tokens" << std::right
+              << std::setw(10) << plain_ns / 1e6 << " ms" << std::setw(10) << mb_per_s(plain_ns) << " MB/s"
+              << std::setw(12) << plain_tokens << " tokens"
+              << std::setw(8) << double(plain_tokens * sizeof(Token)) / fields << " B/value\n";
+    std::cout << std::left << std::setw(24) << "set_literal_rows()" << std::right
+              << std::setw(10) << fast_ns / 1e6 << " ms" << std::setw(10) << mb_per_s(fast_ns) << " MB/s"
+              << std::setw(12) << fast_tokens << " tokens"
+              << std::setw(8) << double(fast_bytes) / fields << " B/value"
+              << std::setw(8) << plain_ns / fast_ns << "x\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    size_t megabytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 32;
+    if (megabytes == 0) {
+        megabytes = 32;
+    }
+
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Bulk Literal Rows (VALUES / IN fast path)\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+
+    run("Multi-row INSERT dump", make_dump(megabytes << 20));
+    run("Large IN lists", make_in_lists(megabytes << 20));
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// Numeric side channel vs re-parsing Number tokens with from_chars
+
+#include <charconv>
+#include <iomanip>
+#include <random>
+#include "bench_common.hpp"
+#include "simd_tokenizer.hpp"
+
+using namespace db25;
+
+int main() {
+    // Literal-heavy bulk INSERT
+    std::mt19937_64 rng(33);
+    std::string input = "INSERT INTO readings VALUES\n";
+    while (input.size() < (16 << 20)) {
+        input += '(';
+        input += std::to_string(rng() % 100000000);
+        input += ", ";
+        input += std::to_string(rng() % 100000);
+        input += '.';
+        input += std::to_string(rng() % 100);
+        input += ", ";
+        input += std::to_string(rng() >> 4);
+        input += ", 1.5e-3),\n";
+    }
+    input += "(0, 0, 0, 0);";
+    const auto* data = reinterpret_cast<const std::byte*>(input.data());
+    constexpr int iterations = 5;
+
+    // Both variants materialize one value per Number token and then sum them
+    size_t numbers = 0;
+    std::vector<double> reparsed;
+    reparsed.reserve(input.size() / 8);
+    double reparse_ns = bench::best_time_ns(iterations, [&] {
+        reparsed.clear();
+        SimdTokenizer tokenizer(data, input.size());
+        Token token;
+        while (tokenizer.next(token)) {
+            if (token.type == TokenType::Number) {
+                double value = 0;
+                std::from_chars(token.value.data(), token.value.data() + token.value.size(), value);
+                reparsed.push_back(value);
+            }
+        }
+        double sum = 0;
+        for (double value : reparsed) {
+            sum += value;
+        }
+        numbers = reparsed.size();
+        bench::do_not_optimize(&sum);
+    });
+
+    std::vector<NumericValue> values;
+    values.reserve(numbers);
+    double fused_ns = bench::best_time_ns(iterations, [&] {
+        values.clear();
+        SimdTokenizer tokenizer(data, input.size());
+        tokenizer.set_numeric_output(&values);
+        Token token;
+        while (tokenizer.next(token)) {
+        }
+        double sum = 0;
+        for (const auto& value : values) {
+            sum += value.value;
+        }
+        bench::do_not_optimize(&sum);
+    });
+
+    double plain_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        Token token;
+        while (tokenizer.next(token)) {
+        }
+        bench::do_not_optimize(&token);
+    });
+
+    SimdTokenizer probe(data, input.size());
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Numeric Literal Side Channel\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Input:        " << input.size() / (1024 * 1024) << " MB, " << numbers << " numbers\n";
+    std::cout << "SIMD Level:   " << probe.simd_level() << "\n\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "lex only               " << std::setw(8) << input.size() / plain_ns * 1e3 << " MB/s\n";
+    std::cout << "lex + from_chars       " << std::setw(8) << input.size() / reparse_ns * 1e3 << " MB/s\n";
+    std::cout << "lex + side channel     " << std::setw(8) << input.size() / fused_ns * 1e3 << " MB/s\n";
+    std::cout << "Conversion cost:       " << (reparse_ns - plain_ns) / numbers << " ns/number re-parsed, "
+              << (fused_ns - plain_ns) / numbers << " ns/number fused\n";
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// pg_dump plain-format scripts: lexing COPY data as SQL vs psql script
+// mode, and the "\." search itself against memchr/string_view::find.
+//
+// Usage: bench_psql_script [input MB, default 64]
+
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <string>
+#include "bench_common.hpp"
+#include "psql_script.hpp"
+#include "simd_tokenizer.hpp"
+
+using namespace db25;
+
+namespace {
+
+std::string make_dump(size_t min_bytes) {
+    std::string sql = "\\restrict q7Kd2\nSET client_encoding = 'UTF8';\n";
+    size_t id = 0;
+    for (int table = 0; sql.size() < min_bytes; ++table) {
+        sql += "\n--\n-- Data for Name: events_" + std::to_string(table) + "; Type: TABLE DATA\n--\n\n";
+        sql += "COPY public.events_" + std::to_string(table) + " (id, kind, payload, created) FROM stdin;\n";
+        for (int row = 0; row < 20000; ++row, ++id) {
+            sql += std::to_string(id) + "\tclick\t{\"page\": \"/item/" + std::to_string(id % 977) +
+                   "\", \"ref\": 'x'}\t2024-01-" + std::to_string(1 + id % 28) + " 12:00:00\n";
+        }
+        sql += "\\.\n\nSELECT pg_catalog.setval('events_id_seq', " + std::to_string(id) + ", true);\n";
+    }
+    return sql;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    size_t megabytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 64;
+    if (megabytes == 0) {
+        megabytes = 64;
+    }
+    std::string input = make_dump(megabytes << 20);
+    const auto* data = reinterpret_cast<const std::byte*>(input.data());
+    constexpr int iterations = 5;
+
+    size_t plain_tokens = 0;
+    double plain_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        auto tokens = tokenizer.tokenize();
+        plain_tokens = tokens.size();
+        bench::do_not_optimize(tokens.data());
+    });
+
+    size_t psql_tokens = 0;
+    double psql_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        tokenizer.set_psql_script(true);
+        auto tokens = tokenizer.tokenize();
+        psql_tokens = tokens.size();
+        bench::do_not_optimize(tokens.data());
+    });
+
+    // The terminator search alone over one data block the size of the input;
+    // lines carry a \N (NULL) as dumps usually do
+    std::string block(input.size(), 'x');
+    for (size_t i = 80; i < block.size(); i += 81) {
+        block[i] = '\n';
+        block[i - 40] = '\\';
+        block[i - 39] = 'N';
+    }
+    block += "\n\\.\n";
+    const auto* block_data = reinterpret_cast<const std::byte*>(block.data());
+    size_t found = 0;
+    double simd_ns = bench::best_time_ns(iterations, [&] {
+        found = find_copy_data_end(block_data, block.size(), 0).end;
+        bench::do_not_optimize(found);
+    });
+    double find_ns = bench::best_time_ns(iterations, [&] {
+        found = std::string_view(block).find("\n\\.\n");
+        bench::do_not_optimize(found);
+    });
+    double memchr_ns = bench::best_time_ns(iterations, [&] {
+        // memchr for '\' and check the line start, as a scalar loader would
+        const char* p = block.data();
+        const char* end = p + block.size();
+        while ((p = static_cast<const char*>(std::memchr(p, '\\', end - p))) != nullptr && p[-1] != '\n') ++p;
+        bench::do_not_optimize(p);
+    });
+
+    auto mb_per_s = [&](double ns, size_t bytes) { return bytes / (ns / 1e9) / (1024.0 * 1024.0); };
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "psql Scripts (" << input.size() / (1024 * 1024) << " MB pg_dump-style input)\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << std::left << std::setw(28) << "COPY data lexed as SQL" << std::right
+              << std::setw(10) << plain_ns / 1e6 << " ms" << std::setw(10) << mb_per_s(plain_ns, input.size())
+              << " MB/s" << std::setw(12) << plain_tokens << " tokens\n";
+    std::cout << std::left << std::setw(28) << "set_psql_script(true)" << std::right
+              << std::setw(10) << psql_ns / 1e6 << " ms" << std::setw(10) << mb_per_s(psql_ns, input.size())
+              << " MB/s" << std::setw(12) << psql_tokens << " tokens"
+              << std::setw(8) << plain_ns / psql_ns << "x\n";
+
+    std::cout << "\n\"\\.\" line search over " << block.size() / (1024 * 1024) << " MB of data lines\n";
+    std::cout << std::string(80, '-') << "\n";
+    std::cout << std::left << std::setw(28) << "find_copy_data_end()" << std::right
+              << std::setw(10) << simd_ns / 1e6 << " ms" << std::setw(10) << mb_per_s(simd_ns, block.size()) << " MB/s\n";
+    std::cout << std::left << std::setw(28) << "memchr('\\') + line check" << std::right
+              << std::setw(10) << memchr_ns / 1e6 << " ms" << std::setw(10) << mb_per_s(memchr_ns, block.size()) << " MB/s\n";
+    std::cout << std::left << std::setw(28) << "string_view::find()" << std::right
+              << std::setw(10) << find_ns / 1e6 << " ms" << std::setw(10) << mb_per_s(find_ns, block.size()) << " MB/s\n";
+    return 0;
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// Per-query latency distribution (p50/p90/p99/p99.9/max) for small queries
+//
+// Every construct+tokenize() is timed on its own with the TSC and recorded
+// in a log-linear (HDR-style) histogram, so per-query fixed costs such as
+// dispatcher setup or the initial reserve() show up in the tail instead of
+// vanishing into an MB/s average. Rows are split by:
+//   class  generated ~100-byte OLTP statements, or the corpus statements
+//   cache  warm (same query back to back) or cold (caches flushed before
+//          every call, queries drawn round-robin)
+//   simd   every level up to the detected one (CpuDetection::cap_level)
+//   path   construct+tokenize(), or a reused output vector filled via
+//          next(); a single batch tokenize() of all queries gives the
+//          amortized per-query cost for comparison
+
+#include <bit>
+#include <iomanip>
+#include <thread>
+#include "bench_common.hpp"
+#include "simd_tokenizer.hpp"
+#include "statement_splitter.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <x86intrin.h>
+#endif
+
+using namespace db25;
+
+namespace {
+
+inline uint64_t ticks() noexcept {
+#if defined(__x86_64__) || defined(_M_X64)
+    _mm_lfence();
+    uint64_t t = __rdtsc();
+    _mm_lfence();
+    return t;
+#else
+    return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+// Nanoseconds per tick, measured against the steady clock
+double calibrate_ticks() {
+    auto start_time = std::chrono::steady_clock::now();
+    uint64_t start = ticks();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    uint64_t end = ticks();
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start_time).count();
+    return ns / static_cast<double>(end - start);
+}
+
+// Log-linear histogram: values below 2^SUB_BITS are exact, larger ones keep
+// SUB_BITS - 1 significant bits (< 3.2% relative error)
+class LatencyHistogram {
+private:
+    static constexpr unsigned SUB_BITS = 6;
+    static constexpr uint64_t SUB_COUNT = 1u << SUB_BITS;
+    std::vector<uint64_t> counts_ = std::vector<uint64_t>(SUB_COUNT * 64, 0);
+    uint64_t total_ = 0;
+    uint64_t max_ = 0;
+    double sum_ = 0;
+
+    static size_t index_of(uint64_t value) noexcept {
+        if (value < SUB_COUNT) return value;
+        unsigned shift = static_cast<unsigned>(std::bit_width(value)) - SUB_BITS;
+        return shift * (SUB_COUNT / 2) + (value >> shift);
+    }
+
+    static uint64_t value_of(size_t index) noexcept {
+        if (index < SUB_COUNT) return index;
+        size_t shift = index / (SUB_COUNT / 2) - 1;
+        uint64_t sub = index - shift * (SUB_COUNT / 2);
+        return ((sub + 1) << shift) - 1;   // Upper end of the bucket
+    }
+
+public:
+    void record(uint64_t value) noexcept {
+        ++counts_[index_of(value)];
+        ++total_;
+        max_ = std::max(max_, value);
+        sum_ += static_cast<double>(value);
+    }
+
+    [[nodiscard]] uint64_t percentile(double p) const noexcept {
+        auto target = static_cast<uint64_t>(p / 100.0 * static_cast<double>(total_) + 0.5);
+        target = std::max<uint64_t>(target, 1);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= target) return std::min(value_of(i), max_);
+        }
+        return max_;
+    }
+
+    [[nodiscard]] uint64_t max() const noexcept { return max_; }
+    [[nodiscard]] double mean() const noexcept { return total_ ? sum_ / static_cast<double>(total_) : 0.0; }
+};
+
+// Touched between cold samples; evicts L1/L2 and most of a typical L3
+class CacheFlusher {
+private:
+    std::vector<char> buffer_ = std::vector<char>(32u << 20, 1);
+
+public:
+    void flush() noexcept {
+        for (size_t i = 0; i < buffer_.size(); i += 64) {
+            buffer_[i] = static_cast<char>(buffer_[i] + 1);
+        }
+        bench::do_not_optimize(buffer_.data());
+    }
+};
+
+enum class Path { Construct, Reuse };
+
+struct Row {
+    const char* cls;
+    const char* cache;
+    const char* simd;
+    const char* path;
+};
+
+double tick_ns = 1.0;
+
+void print_header() {
+    std::cout << std::left << std::setw(8) << "class" << std::setw(6) << "cache" << std::setw(9) << "simd"
+              << std::setw(11) << "path" << std::right << std::setw(8) << "p50" << std::setw(8) << "p90"
+              << std::setw(8) << "p99" << std::setw(8) << "p99.9" << std::setw(9) << "max" << std::setw(8)
+              << "mean" << "  (ns)\n";
+    std::cout << std::string(80, '-') << "\n";
+}
+
+void print_row(const Row& row, const LatencyHistogram& h) {
+    auto ns = [](double t) { return static_cast<uint64_t>(t * tick_ns + 0.5); };
+    std::cout << std::left << std::setw(8) << row.cls << std::setw(6) << row.cache << std::setw(9) << row.simd
+              << std::setw(11) << row.path << std::right
+              << std::setw(8) << ns(h.percentile(50)) << std::setw(8) << ns(h.percentile(90))
+              << std::setw(8) << ns(h.percentile(99)) << std::setw(8) << ns(h.percentile(99.9))
+              << std::setw(9) << ns(h.max()) << std::setw(8) << ns(h.mean()) << "\n";
+}
+
+// One timed call: construct a tokenizer and drain it
+inline uint64_t time_query(std::string_view sql, Path path, std::vector<Token>& reused) {
+    const auto* data = reinterpret_cast<const std::byte*>(sql.data());
+    uint64_t start = ticks();
+    if (path == Path::Construct) {
+        SimdTokenizer tokenizer(data, sql.size());
+        auto tokens = tokenizer.tokenize();
+        bench::do_not_optimize(tokens.data());
+    } else {
+        SimdTokenizer tokenizer(data, sql.size());
+        reused.clear();
+        Token token;
+        while (tokenizer.next(token)) {
+            reused.push_back(token);
+        }
+        bench::do_not_optimize(reused.data());
+    }
+    return ticks() - start;
+}
+
+void run_class(const char* cls, const std::vector<std::string_view>& queries, const char* simd,
+               CacheFlusher& flusher) {
+    constexpr size_t WARM_SAMPLES = 100000;
+    constexpr size_t COLD_SAMPLES = 500;
+    std::vector<Token> reused;
+    reused.reserve(4096);
+
+    for (Path path : {Path::Construct, Path::Reuse}) {
+        const char* path_name = path == Path::Construct ? "construct" : "reuse";
+
+        LatencyHistogram warm;
+        for (size_t i = 0; i < WARM_SAMPLES; ++i) {
+            std::string_view sql = queries[(i / 16) % queries.size()];   // Same query 16 times in a row
+            warm.record(time_query(sql, path, reused));
+        }
+        print_row({cls, "warm", simd, path_name}, warm);
+
+        LatencyHistogram cold;
+        for (size_t i = 0; i < COLD_SAMPLES; ++i) {
+            flusher.flush();
+            cold.record(time_query(queries[i % queries.size()], path, reused));
+        }
+        print_row({cls, "cold", simd, path_name}, cold);
+    }
+
+    // Batch: all queries in one input, cost divided per query
+    std::string batch;
+    for (std::string_view sql : queries) {
+        batch += sql;
+        batch += ";\n";
+    }
+    double batch_ns = bench::best_time_ns(5, [&] {
+        SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(batch.data()), batch.size());
+        auto tokens = tokenizer.tokenize();
+        bench::do_not_optimize(tokens.data());
+    });
+    std::cout << std::left << std::setw(8) << cls << std::setw(6) << "warm" << std::setw(9) << simd
+              << std::setw(11) << "batch" << std::right << std::setw(57)
+              << static_cast<uint64_t>(batch_ns / static_cast<double>(queries.size()) + 0.5) << "\n";
+}
+
+// Point lookups and single-row writes, ~100 bytes each
+std::vector<std::string> oltp_queries() {
+    std::vector<std::string> queries;
+    for (int i = 0; i < 64; ++i) {
+        std::string id = std::to_string(100000 + i * 7919);
+        queries.push_back("SELECT id, name, email, status FROM users WHERE id = " + id + " AND tenant_id = 42");
+        queries.push_back("UPDATE accounts SET balance = balance - 25.00, updated_at = NOW() WHERE id = " + id);
+        queries.push_back("INSERT INTO events (user_id, kind, payload) VALUES (" + id + ", 'login', '{\"ok\":1}')");
+        queries.push_back("DELETE FROM sessions WHERE user_id = " + id + " AND expires_at < CURRENT_TIMESTAMP");
+    }
+    return queries;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::string corpus = bench::load_file(argc > 1 ? argv[1] : bench::DEFAULT_CORPUS);
+    if (corpus.empty()) {
+        return 1;
+    }
+
+    std::vector<std::string> oltp = oltp_queries();
+    std::vector<std::string_view> oltp_views(oltp.begin(), oltp.end());
+    std::vector<std::string_view> corpus_views;
+    for (const auto& span : split_statements(corpus)) {
+        corpus_views.push_back(span.text(corpus));
+    }
+    size_t oltp_bytes = 0;
+    for (std::string_view sql : oltp_views) {
+        oltp_bytes += sql.size();
+    }
+
+    tick_ns = calibrate_ticks();
+    CacheFlusher flusher;
+
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Per-Query Latency (oltp: " << oltp_views.size() << " x ~" << oltp_bytes / oltp_views.size()
+              << " B, corpus: " << corpus_views.size() << " statements)\n";
+    std::cout << std::string(80, '=') << "\n";
+    print_header();
+
+    SimdLevel detected = CpuDetection::detect();
+    std::vector<SimdLevel> levels = {SimdLevel::None};
+#if defined(__x86_64__) || defined(_M_X64)
+    for (SimdLevel level : {SimdLevel::SSE42, SimdLevel::AVX2, SimdLevel::AVX512}) {
+        if (level <= detected) levels.push_back(level);
+    }
+#else
+    if (detected != SimdLevel::None) levels.push_back(detected);
+#endif
+
+    for (SimdLevel level : levels) {
+        CpuDetection::cap_level(level);
+        const char* simd = CpuDetection::level_name();
+        run_class("oltp", oltp_views, simd, flusher);
+        run_class("corpus", corpus_views, simd, flusher);
+    }
+    CpuDetection::clear_level_cap();
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// Early-exit classify_statement() vs a full tokenize() per statement
+
+#include <iomanip>
+#include "bench_common.hpp"
+#include "statement_classifier.hpp"
+#include "statement_splitter.hpp"
+
+using namespace db25;
+
+static void report(const char* name, size_t bytes, size_t statements, double classify_ns, double tokenize_ns) {
+    std::cout << std::left << std::setw(20) << name << std::right
+              << std::setw(10) << classify_ns / statements << " ns/stmt classify"
+              << std::setw(12) << tokenize_ns / statements << " ns/stmt tokenize"
+              << std::setw(10) << tokenize_ns / classify_ns << "x  ("
+              << bytes / statements << " bytes/stmt)\n";
+}
+
+template<typename Statements>
+static void run(const char* name, const Statements& statements) {
+    constexpr int iterations = 5;
+    size_t bytes = 0;
+    for (std::string_view sql : statements) {
+        bytes += sql.size();
+    }
+
+    size_t writes = 0;
+    double classify_ns = bench::best_time_ns(iterations, [&] {
+        writes = 0;
+        for (std::string_view sql : statements) {
+            writes += classify_statement(sql).writes;
+        }
+    });
+    double tokenize_ns = bench::best_time_ns(iterations, [&] {
+        for (std::string_view sql : statements) {
+            SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+            auto tokens = tokenizer.tokenize();
+            bench::do_not_optimize(tokens.data());
+        }
+    });
+    bench::do_not_optimize(&writes);
+    report(name, bytes, statements.size(), classify_ns, tokenize_ns);
+}
+
+int main(int argc, char* argv[]) {
+    std::string corpus = bench::load_file(argc > 1 ? argv[1] : bench::DEFAULT_CORPUS);
+    if (corpus.empty()) {
+        return 1;
+    }
+
+    std::vector<std::string_view> statements;
+    for (const auto& span : split_statements(corpus)) {
+        statements.push_back(span.text(corpus));
+    }
+
+    // Bulk loads: one multi-row INSERT and one long IN-list SELECT
+    std::string insert = "INSERT INTO events (id, payload) VALUES ";
+    std::string select = "SELECT * FROM events WHERE id IN (";
+    insert.reserve(1 << 20);
+    select.reserve(1 << 19);
+    for (int i = 0; i < 50000; ++i) {
+        insert.append("(").append(std::to_string(i)).append(", 'payload'), ");
+        select.append(std::to_string(i)).append(", ");
+    }
+    insert += "(0, '')";
+    select += "0)";
+    std::vector<std::string_view> bulk = {insert, select};
+
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Statement Classification (routing)\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << std::fixed << std::setprecision(1);
+    run("corpus statements", statements);
+    run("bulk statements", bulk);
+    return 0;
+}
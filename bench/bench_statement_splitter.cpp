@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// SIMD statement splitting vs splitting on ';' tokens from tokenize()
+
+#include <iomanip>
+#include "bench_common.hpp"
+#include "statement_splitter.hpp"
+#include "simd_tokenizer.hpp"
+
+using namespace db25;
+
+int main(int argc, char* argv[]) {
+    std::string corpus = bench::load_file(argc > 1 ? argv[1] : bench::DEFAULT_CORPUS);
+    if (corpus.empty()) {
+        return 1;
+    }
+    std::string input = bench::replicate(corpus, 32 << 20);
+    const auto* data = reinterpret_cast<const std::byte*>(input.data());
+    constexpr int iterations = 5;
+
+    StatementSplitter splitter;
+    size_t statements = 0;
+    double split_ns = bench::best_time_ns(iterations, [&] {
+        auto spans = splitter.split(data, input.size());
+        statements = spans.size();
+        bench::do_not_optimize(spans.data());
+    });
+
+    size_t token_statements = 0;
+    double tokenize_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        size_t count = 0;
+        for (const auto& token : tokenizer.tokenize()) {
+            count += token.type == TokenType::Delimiter && token.value == ";";
+        }
+        token_statements = count;
+    });
+
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Statement Splitting\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Input:        " << input.size() / (1024 * 1024) << " MB, "
+              << statements << " statements (" << token_statements << " ';' tokens)\n";
+    std::cout << "SIMD Level:   " << splitter.simd_level() << "\n\n";
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "split()       " << std::setw(10) << input.size() / split_ns * 1e3 << " MB/s\n";
+    std::cout << "tokenize()    " << std::setw(10) << input.size() / tokenize_ns * 1e3 << " MB/s\n";
+    std::cout << "Speedup:      " << tokenize_ns / split_ns << "x\n";
+    return 0;
+}
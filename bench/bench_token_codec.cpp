@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// Compressed token encoding: size per token and encode/decode throughput
+
+#include <iomanip>
+#include "bench_common.hpp"
+#include "token_codec.hpp"
+
+using namespace db25;
+
+int main(int argc, char* argv[]) {
+    std::string corpus = bench::load_file(argc > 1 ? argv[1] : bench::DEFAULT_CORPUS);
+    if (corpus.empty()) {
+        return 1;
+    }
+    std::string input = bench::replicate(corpus, 32 << 20);
+    const auto* data = reinterpret_cast<const std::byte*>(input.data());
+    constexpr int iterations = 5;
+
+    SimdTokenizer tokenizer(data, input.size());
+    auto tokens = tokenizer.tokenize();
+
+    std::vector<uint8_t> encoded;
+    double encode_ns = bench::best_time_ns(iterations, [&] {
+        encoded = encode_tokens(data, input.size(), tokens);
+        bench::do_not_optimize(encoded.data());
+    });
+
+    TokenDecoder decoder(encoded, data, input.size());
+    std::vector<Token> decoded(tokens.size());
+    double decode_ns = bench::best_time_ns(iterations, [&] {
+        Token* out = decoded.data();
+        for (size_t b = 0; b < decoder.block_count(); ++b) {
+            out += decoder.decode_block(b, out);
+        }
+        bench::do_not_optimize(decoded.data());
+    });
+
+    const double token_bytes = double(tokens.size() * sizeof(Token));
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Compressed Token Encoding\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Input:        " << input.size() / (1024 * 1024) << " MB, " << tokens.size() << " tokens\n";
+    std::cout << "SIMD Level:   " << decoder.simd_level() << "\n\n";
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Encoded:      " << double(encoded.size()) / tokens.size() << " bytes/token ("
+              << token_bytes / encoded.size() << "x smaller than Token[])\n";
+    std::cout << std::setprecision(1);
+    std::cout << "encode        " << std::setw(10) << token_bytes / encode_ns << " GB/s of Token[]\n";
+    std::cout << "decode        " << std::setw(10) << token_bytes / decode_ns << " GB/s of Token[], "
+              << decode_ns / tokens.size() << " ns/token\n";
+    return 0;
+}
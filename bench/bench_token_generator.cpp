@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// Per-token overhead of the coroutine generator vs the vector and pull APIs
+
+#include <iomanip>
+#include "bench_common.hpp"
+#include "token_generator.hpp"
+
+using namespace db25;
+
+int main(int argc, char* argv[]) {
+    std::string corpus = bench::load_file(argc > 1 ? argv[1] : bench::DEFAULT_CORPUS);
+    if (corpus.empty()) {
+        return 1;
+    }
+    std::string input = bench::replicate(corpus, 8 << 20);
+    const auto* data = reinterpret_cast<const std::byte*>(input.data());
+    constexpr int iterations = 5;
+
+    size_t token_count = 0;
+    double vector_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        auto tokens = tokenizer.tokenize();
+        token_count = tokens.size();
+        bench::do_not_optimize(tokens.data());
+    });
+
+    double pull_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        Token token;
+        size_t sum = 0;
+        while (tokenizer.next(token)) {
+            sum += token.value.size();
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    double generator_ns = bench::best_time_ns(iterations, [&] {
+        SimdTokenizer tokenizer(data, input.size());
+        InlineFrameArena<512> arena;
+        size_t sum = 0;
+        for (const Token& token : generate_tokens(arena, tokenizer)) {
+            sum += token.value.size();
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Token Generator Overhead\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Input:        " << input.size() / (1024 * 1024) << " MB, "
+              << token_count << " tokens\n";
+    std::cout << "SIMD Level:   " << SimdTokenizer(nullptr, 0).simd_level() << "\n\n";
+
+    auto report = [&](const char* name, double ns) {
+        std::cout << std::setw(14) << std::left << name
+                  << std::fixed << std::setprecision(2) << std::setw(8) << std::right
+                  << ns / token_count << " ns/token  "
+                  << std::setw(8) << (input.size() / ns) * 1e3 << " MB/s  "
+                  << std::showpos << std::setw(7) << (ns / vector_ns - 1.0) * 100 << std::noshowpos
+                  << "% vs vector\n";
+    };
+    report("tokenize()", vector_ns);
+    report("next()", pull_ns);
+    report("generator", generator_ns);
+    return 0;
+}
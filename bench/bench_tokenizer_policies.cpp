@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// Throughput of the TokenizerPolicy variants on the replicated corpus
+
+#include <iomanip>
+#include "bench_common.hpp"
+#include "simd_tokenizer.hpp"
+
+using namespace db25;
+
+template<typename Policy>
+static double run(const std::string& input, const char* name, double baseline_ns, bool compounds = false,
+                  BracketIndex* brackets = nullptr) {
+    const auto* data = reinterpret_cast<const std::byte*>(input.data());
+    size_t tokens = 0;
+    double ns = bench::best_time_ns(5, [&] {
+        BasicSimdTokenizer<Policy> tokenizer(data, input.size());
+        tokenizer.set_compound_keywords(compounds);
+        if (brackets != nullptr) {
+            brackets->clear();
+            tokenizer.set_bracket_output(brackets);
+        }
+        Token token;
+        tokens = 0;
+        while (tokenizer.next(token)) {
+            ++tokens;
+        }
+        bench::do_not_optimize(&token);
+    });
+    
+    std::cout << std::left << std::setw(32) << name << std::right
+              << std::setw(9) << input.size() / ns * 1e3 << " MB/s"
+              << std::setw(10) << ns / tokens << " ns/token"
+              << std::setw(9) << tokens << " tokens";
+    if (baseline_ns > 0) {
+        std::cout << std::setw(8) << baseline_ns / ns << "x";
+    }
+    std::cout << "\n";
+    return ns;
+}
+
+int main(int argc, char* argv[]) {
+    std::string corpus = bench::load_file(argc > 1 ? argv[1] : bench::DEFAULT_CORPUS);
+    if (corpus.empty()) {
+        return 1;
+    }
+    std::string input = bench::replicate(corpus, 8 << 20);
+    
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Tokenizer Policy Variants\n";
+    std::cout << std::string(80, '=') << "\n";
+    std::cout << "Input:        " << input.size() / (1024 * 1024) << " MB\n\n";
+    std::cout << std::fixed << std::setprecision(2);
+    
+    double baseline = run<DefaultTokenizerPolicy>(input, "default (linter)", 0);
+    run<TokenizerPolicy<false>>(input, "no comments", baseline);
+    run<TokenizerPolicy<true, false>>(input, "no positions", baseline);
+    run<TokenizerPolicy<true, true, KeywordMode::Lookup>>(input, "keyword lookup only", baseline);
+    run<TokenizerPolicy<true, true, KeywordMode::None>>(input, "no keywords", baseline);
+    run<RouterTokenizerPolicy>(input, "router (no comments/positions)", baseline);
+    run<TokenizerPolicy<false, false, KeywordMode::None>>(input, "minimal", baseline);
+    
+    std::cout << "\nCompound keyword fusion (ORDER BY, IS NOT NULL, ...):\n";
+    run<DefaultTokenizerPolicy>(input, "default + compounds", baseline, true);
+    run<RouterTokenizerPolicy>(input, "router + compounds", baseline, true);
+    
+    BracketIndex brackets;
+    std::cout << "\nMatching-bracket index:\n";
+    run<DefaultTokenizerPolicy>(input, "default + bracket index", baseline, false, &brackets);
+    run<RouterTokenizerPolicy>(input, "router + bracket index", baseline, false, &brackets);
+    
+    std::cout << "\nGenerated DFA lexer (lexer_dfa.hpp):\n";
+    run<TokenizerPolicy<true, true, KeywordMode::Full, LexerKind::Dfa>>(input, "dfa", baseline);
+    run<TokenizerPolicy<false, false, KeywordMode::Full, LexerKind::Dfa>>(input, "dfa router", baseline);
+    run<TokenizerPolicy<false, false, KeywordMode::None, LexerKind::Dfa>>(input, "dfa minimal", baseline);
+    return 0;
+}
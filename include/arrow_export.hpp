@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Columnar token export (Arrow C Data Interface)
+// ==============================================
+// Tokenizes straight into column buffers and hands them over as an Arrow
+// struct array; there is no intermediate std::vector<Token>. The buffers
+// are owned by the array and freed by its release callback, so a consumer
+// (pyarrow, DuckDB, Polars, ...) imports them without copying. Each child
+// owns its own column: children moved out of the struct stay valid after
+// the parent is released.
+//
+// Columns (all non-nullable):
+//   type        uint8   TokenType
+//   keyword_id  uint16  Keyword (0 unless type is Keyword)
+//   offset      uint64  Byte offset of the token in the input
+//   length      uint32  Token length in bytes
+//   line        uint32  1-based line
+//   statement   uint32  0-based statement index; ';' closes a statement
+//
+// Token text is not copied: offset/length index the caller's input.
+
+#include "simd_tokenizer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Arrow C Data Interface, verbatim from the specification. The guard lets
+// this header coexist with arrow/c/abi.h and nanoarrow.
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+namespace db25 {
+
+struct ArrowExportOptions {
+    bool emit_comments = true;      // false drops comment tokens
+};
+
+// Fills `schema` with the token struct type. The caller owns the result
+// and must call schema->release.
+void export_token_schema(ArrowSchema* schema);
+
+// Tokenizes the input into `array` (and, if non-null, its schema into
+// `schema`). The caller owns the results and must call their release
+// callbacks. Returns the number of tokens.
+size_t export_tokens_arrow(const std::byte* input, size_t size, ArrowArray* array,
+                           ArrowSchema* schema = nullptr, const ArrowExportOptions& options = {});
+
+inline size_t export_tokens_arrow(std::string_view sql, ArrowArray* array, ArrowSchema* schema = nullptr,
+                                  const ArrowExportOptions& options = {}) {
+    return export_tokens_arrow(reinterpret_cast<const std::byte*>(sql.data()), sql.size(), array, schema,
+                               options);
+}
+
+}  // namespace db25
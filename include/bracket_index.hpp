@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Matching-bracket index
+// ======================
+// Filled by the tokenizer while it lexes (set_bracket_output): for every
+// token its nesting depth, and for every ( [ { ) ] } the index of its
+// partner. A parser skips a parenthesized subquery or argument list with
+// one lookup (skip()) instead of rescanning for the closing token.
+//
+// Unbalanced input is reported from the same pass: a closing delimiter
+// without a matching opener gets NO_MATCH and is remembered in
+// first_mismatch; openers still on the stack at the end are unclosed.
+
+#include "operator_kind.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace db25 {
+
+struct BracketIndex {
+    static constexpr uint32_t NO_MATCH = UINT32_MAX;
+
+    struct OpenBracket {
+        uint32_t token;
+        OperatorKind kind;
+    };
+
+    std::vector<uint32_t> match;        // Per token: partner index, NO_MATCH for non-brackets and unbalanced ones
+    std::vector<uint32_t> depth;        // Per token: brackets enclosing it (a pair has its outside depth)
+    std::vector<OpenBracket> open;      // Openers not closed yet, innermost last
+    uint32_t first_mismatch = NO_MATCH; // First closer that did not match the innermost opener
+
+    void clear() noexcept {
+        match.clear();
+        depth.clear();
+        open.clear();
+        first_mismatch = NO_MATCH;
+    }
+
+    // Called by the tokenizer for every token in stream order
+    void record(uint64_t token_index, OperatorKind kind) {
+        auto index = static_cast<uint32_t>(token_index);
+        if (match.size() < index) {
+            match.resize(index, NO_MATCH);
+            depth.resize(index, 0);
+        }
+        auto current = static_cast<uint32_t>(open.size());
+
+        switch (kind) {
+            case OperatorKind::LeftParen:
+            case OperatorKind::LeftBracket:
+            case OperatorKind::LeftBrace:
+                open.push_back({index, kind});
+                break;
+            case OperatorKind::RightParen:
+            case OperatorKind::RightBracket:
+            case OperatorKind::RightBrace:
+                // Openers precede their closers by one in the enum
+                if (!open.empty() && static_cast<uint8_t>(open.back().kind) + 1 == static_cast<uint8_t>(kind)) {
+                    uint32_t opener = open.back().token;
+                    open.pop_back();
+                    match[opener] = index;
+                    match.push_back(opener);
+                    depth.push_back(current - 1);
+                    return;
+                }
+                if (first_mismatch == NO_MATCH) {
+                    first_mismatch = index;
+                }
+                break;
+            default:
+                break;
+        }
+        match.push_back(NO_MATCH);
+        depth.push_back(current);
+    }
+
+    [[nodiscard]] bool balanced() const noexcept {
+        return first_mismatch == NO_MATCH && open.empty();
+    }
+
+    // First token that breaks the nesting (a mismatched closer or the
+    // outermost unclosed opener), NO_MATCH if balanced so far
+    [[nodiscard]] uint32_t first_unbalanced() const noexcept {
+        uint32_t unclosed = open.empty() ? NO_MATCH : open.front().token;
+        return first_mismatch < unclosed ? first_mismatch : unclosed;
+    }
+
+    // Index just past token `i`, or past its whole group if it is a
+    // matched opener
+    [[nodiscard]] uint32_t skip(uint32_t i) const noexcept {
+        uint32_t partner = match[i];
+        return partner != NO_MATCH && partner > i ? partner + 1 : i + 1;
+    }
+};
+
+static_assert(static_cast<uint8_t>(OperatorKind::LeftParen) + 1 == static_cast<uint8_t>(OperatorKind::RightParen));
+static_assert(static_cast<uint8_t>(OperatorKind::LeftBracket) + 1 == static_cast<uint8_t>(OperatorKind::RightBracket));
+static_assert(static_cast<uint8_t>(OperatorKind::LeftBrace) + 1 == static_cast<uint8_t>(OperatorKind::RightBrace));
+
+}  // namespace db25
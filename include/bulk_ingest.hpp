@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Bulk ingestion of many small SQL files
+// ======================================
+// An I/O thread batches open/read/close through io_uring into a pool of
+// registered buffers and hands each completed file to a pool of tokenizer
+// workers, so disk latency overlaps with lexing. On systems without
+// io_uring (or when the ring cannot be created) the same pipeline runs
+// with blocking open/read/close on the I/O thread.
+
+#include "simd_tokenizer.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string_view>
+
+namespace db25 {
+
+struct IngestOptions {
+    unsigned queue_depth = 64;            // Files in flight = number of buffers
+    size_t buffer_size = 256 * 1024;      // Per-buffer size; larger files spill to the heap
+    unsigned workers = 0;                 // Tokenizer threads (0 = hardware concurrency)
+    bool use_io_uring = true;             // false forces the blocking fallback
+};
+
+struct IngestStats {
+    size_t files = 0;          // Files read and tokenized
+    size_t failed = 0;         // Files that could not be opened or read
+    size_t bytes = 0;
+    size_t tokens = 0;
+    double seconds = 0.0;
+    bool used_io_uring = false;
+
+    [[nodiscard]] double files_per_second() const noexcept {
+        return seconds > 0 ? files / seconds : 0.0;
+    }
+    [[nodiscard]] double mb_per_second() const noexcept {
+        return seconds > 0 ? bytes / seconds / (1024.0 * 1024.0) : 0.0;
+    }
+};
+
+// Passed to the callback for every input file. `contents` and `tokens` are
+// only valid for the duration of the callback; `error` is an errno value
+// (0 on success).
+struct IngestedFile {
+    const std::filesystem::path& path;
+    std::string_view contents;
+    std::span<const Token> tokens;
+    int error;
+};
+
+// Invoked concurrently from the worker threads
+using IngestCallback = std::function<void(const IngestedFile&)>;
+
+// Reads and tokenizes every file in `paths`, invoking `on_file` once per path
+[[nodiscard]] IngestStats ingest_files(std::span<const std::filesystem::path> paths,
+                                       const IngestCallback& on_file,
+                                       const IngestOptions& options = {});
+
+// True when the running kernel accepts io_uring with the opcodes ingest uses
+[[nodiscard]] bool io_uring_available() noexcept;
+
+}  // namespace db25
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Compile-time tokenization of embedded SQL
+// =========================================
+// A constexpr scalar lexer for SQL string literals compiled into a
+// program. It follows the default SimdTokenizer rules (comments emitted,
+// positions tracked, keyword lookup) and uses the same constexpr tables:
+// GrammarDispatch's character classes, the generated KEYWORDS, and
+// match_operator().
+//
+//     constexpr auto tokens = db25::tokenize_ct<"SELECT id FROM users WHERE id = ?">();
+//     static_assert(tokens[0].keyword == db25::Keyword::SELECT);
+//
+// tokenize_ct() is consteval. Malformed SQL does not compile: unterminated
+// strings or block comments, invalid UTF-8, and unbalanced ( [ { ) ] }.
+// lex_ct() is the same lexer reporting the error in the result instead.
+//
+// Tokens hold offsets into the literal; text() and token() give the
+// runtime views.
+//
+// Storage: a CtToken is 20 bytes. tokenize_ct<"...">() lexes twice and
+// keeps exactly count_tokens() of them, so an embedded query costs about
+// 20 bytes per token in .rodata. lex_ct(sql) and tokenize_ct(sql), taking
+// the literal as a function argument, cannot size their result by its
+// contents and hold one CtToken per input byte: about 20x the literal.
+
+#include "simd_tokenizer.hpp"
+#include "grammar_dispatch.hpp"
+#include "utf8.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace db25 {
+
+enum class CtError : uint8_t {
+    None,
+    UnterminatedString,     // '...' or "..." without its closing quote
+    UnterminatedComment,    // /* without */
+    InvalidUtf8,            // A byte that does not start a well-formed sequence
+    UnbalancedBrackets      // Mismatched closer, or an opener left open
+};
+
+struct CtToken {
+    TokenType type = TokenType::Unknown;
+    OperatorKind op = OperatorKind::None;
+    Keyword keyword = Keyword::UNKNOWN;
+    uint32_t offset = 0;
+    uint32_t length = 0;
+    uint32_t line = 0;
+    uint32_t column = 0;
+};
+
+template<size_t N>
+struct CtTokens {
+    std::array<CtToken, N> tokens{};
+    size_t count = 0;
+    const char* source = nullptr;
+    size_t source_size = 0;
+    CtError error = CtError::None;
+    size_t error_offset = 0;
+
+    [[nodiscard]] constexpr size_t size() const noexcept { return count; }
+    [[nodiscard]] constexpr const CtToken& operator[](size_t i) const noexcept { return tokens[i]; }
+    [[nodiscard]] constexpr const CtToken* begin() const noexcept { return tokens.data(); }
+    [[nodiscard]] constexpr const CtToken* end() const noexcept { return tokens.data() + count; }
+
+    [[nodiscard]] constexpr std::string_view text(const CtToken& token) const noexcept {
+        return {source + token.offset, token.length};
+    }
+
+    // The token as SimdTokenizer would have produced it
+    [[nodiscard]] Token token(size_t i) const noexcept {
+        const CtToken& t = tokens[i];
+        Token out(t.type, text(t), t.line, t.column, t.keyword);
+        out.reserved = static_cast<uint8_t>(t.op);
+        return out;
+    }
+};
+
+namespace ct_detail {
+
+// Case-insensitive lookup in the generated keyword table
+[[nodiscard]] constexpr Keyword find_keyword(std::string_view text) noexcept {
+    for (const auto& bucket : LENGTH_BUCKETS) {
+        if (KEYWORDS[bucket.start].length != text.size()) {
+            continue;
+        }
+        for (size_t i = bucket.start; i < bucket.start + bucket.count; ++i) {
+            std::string_view keyword = KEYWORDS[i].text;
+            size_t j = 0;
+            for (; j < text.size(); ++j) {
+                char c = text[j] >= 'a' && text[j] <= 'z' ? static_cast<char>(text[j] - 'a' + 'A') : text[j];
+                if (c != keyword[j]) break;
+            }
+            if (j == text.size()) {
+                return KEYWORDS[i].id;
+            }
+        }
+        break;
+    }
+    return Keyword::UNKNOWN;
+}
+
+template<size_t N>
+class Lexer {
+private:
+    const char* input_;
+    size_t size_;
+    size_t position_ = 0;
+    uint32_t line_ = 1;
+    uint32_t column_ = 1;
+
+    [[nodiscard]] constexpr uint8_t at(size_t i) const noexcept { return static_cast<uint8_t>(input_[i]); }
+
+    constexpr void advance(size_t count) noexcept {
+        position_ += count;
+        column_ += static_cast<uint32_t>(count);
+    }
+
+    constexpr void advance_line() noexcept {
+        ++position_;
+        ++line_;
+        column_ = 1;
+    }
+
+    [[nodiscard]] constexpr size_t utf8_length(size_t pos) const noexcept {
+        uint8_t bytes[4] = {};
+        size_t available = size_ - pos < 4 ? size_ - pos : 4;
+        for (size_t i = 0; i < available; ++i) {
+            bytes[i] = at(pos + i);
+        }
+        return utf8_sequence_length(bytes, available);
+    }
+
+    constexpr void scan_word(CtToken& token) noexcept {
+        while (position_ < size_) {
+            uint8_t ch = at(position_);
+            if (GrammarDispatch::is_identifier_cont(ch)) {
+                advance(1);
+                continue;
+            }
+            size_t length = ch >= 0x80 ? utf8_length(position_) : 0;
+            if (length == 0) break;
+            advance(length);
+        }
+        token.keyword = find_keyword({input_ + token.offset, position_ - token.offset});
+        token.type = token.keyword != Keyword::UNKNOWN ? TokenType::Keyword : TokenType::Identifier;
+    }
+
+    constexpr void scan_number() noexcept {
+        bool has_dot = false;
+        bool has_exp = false;
+        while (position_ < size_) {
+            uint8_t ch = at(position_);
+            if (GrammarDispatch::is_digit(ch)) {
+                advance(1);
+            } else if (ch == '.' && !has_dot && !has_exp) {
+                has_dot = true;
+                advance(1);
+            } else if ((ch == 'e' || ch == 'E') && !has_exp) {
+                has_exp = true;
+                advance(1);
+                if (position_ < size_ && (at(position_) == '+' || at(position_) == '-')) {
+                    advance(1);
+                }
+            } else {
+                break;
+            }
+        }
+    }
+
+    // False if the closing quote is missing
+    constexpr bool scan_string(uint8_t quote) noexcept {
+        advance(1);
+        while (position_ < size_) {
+            uint8_t ch = at(position_);
+            if (ch == quote) {
+                if (position_ + 1 < size_ && at(position_ + 1) == quote) {
+                    advance(2);
+                } else {
+                    advance(1);
+                    return true;
+                }
+            } else if (ch == '\n') {
+                advance_line();
+            } else {
+                advance(1);
+            }
+        }
+        return false;
+    }
+
+    constexpr void scan_line_comment() noexcept {
+        advance(2);
+        while (position_ < size_) {
+            if (at(position_) == '\n') {
+                advance_line();
+                return;
+            }
+            advance(1);
+        }
+    }
+
+    // False if */ is missing
+    constexpr bool scan_block_comment() noexcept {
+        advance(2);
+        while (position_ + 1 < size_) {
+            if (at(position_) == '*' && at(position_ + 1) == '/') {
+                advance(2);
+                return true;
+            }
+            if (at(position_) == '\n') {
+                advance_line();
+            } else {
+                advance(1);
+            }
+        }
+        return false;
+    }
+
+public:
+    constexpr Lexer(const char* input, size_t size) noexcept : input_(input), size_(size) {}
+
+    constexpr void run(CtTokens<N>& out) noexcept {
+        OperatorKind open[N > 0 ? N : 1] = {};
+        size_t depth = 0;
+        auto fail = [&](CtError error, size_t offset) {
+            if (out.error == CtError::None) {
+                out.error = error;
+                out.error_offset = offset;
+            }
+        };
+
+        for (;;) {
+            while (position_ < size_ && GrammarDispatch::is_whitespace(at(position_))) {
+                if (at(position_) == '\n') {
+                    advance_line();
+                } else {
+                    advance(1);
+                }
+            }
+            if (position_ >= size_) break;
+
+            CtToken token;
+            token.offset = static_cast<uint32_t>(position_);
+            token.line = line_;
+            token.column = column_;
+            uint8_t first = at(position_);
+            uint8_t second = position_ + 1 < size_ ? at(position_ + 1) : 0;
+
+            if (GrammarDispatch::is_identifier_start(first)) {
+                scan_word(token);
+            } else if (GrammarDispatch::is_digit(first)) {
+                token.type = TokenType::Number;
+                scan_number();
+            } else if (first >= 0x80) {
+                if (utf8_length(position_) > 0) {
+                    scan_word(token);
+                } else {
+                    fail(CtError::InvalidUtf8, position_);
+                    advance(1);
+                }
+            } else if (GrammarDispatch::classify(first) == GrammarDispatch::QUOTE) {
+                token.type = TokenType::String;
+                if (!scan_string(first)) fail(CtError::UnterminatedString, token.offset);
+            } else if (first == '-' && second == '-') {
+                token.type = TokenType::Comment;
+                scan_line_comment();
+            } else if (first == '/' && second == '*') {
+                token.type = TokenType::Comment;
+                if (!scan_block_comment()) fail(CtError::UnterminatedComment, token.offset);
+            } else {
+                uint8_t bytes[3] = {first, second, position_ + 2 < size_ ? at(position_ + 2) : uint8_t{0}};
+                size_t available = size_ - position_ < 3 ? size_ - position_ : 3;
+                OperatorMatch match = match_operator(bytes, available);
+                advance(match.length);
+                token.op = match.kind;
+                token.type = is_delimiter_kind(match.kind) ? TokenType::Delimiter : TokenType::Operator;
+
+                switch (match.kind) {
+                    case OperatorKind::LeftParen:
+                    case OperatorKind::LeftBracket:
+                    case OperatorKind::LeftBrace:
+                        open[depth++] = match.kind;
+                        break;
+                    case OperatorKind::RightParen:
+                    case OperatorKind::RightBracket:
+                    case OperatorKind::RightBrace:
+                        // Openers precede their closers by one in the enum
+                        if (depth > 0 && static_cast<uint8_t>(open[depth - 1]) + 1 == static_cast<uint8_t>(match.kind)) {
+                            --depth;
+                        } else {
+                            fail(CtError::UnbalancedBrackets, token.offset);
+                        }
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            token.length = static_cast<uint32_t>(position_ - token.offset);
+            out.tokens[out.count++] = token;
+        }
+        if (depth > 0) {
+            fail(CtError::UnbalancedBrackets, size_);
+        }
+    }
+};
+
+// Not constexpr: reaching it during constant evaluation stops the build
+inline void embedded_sql_is_malformed(CtError, size_t) {}
+
+}  // namespace ct_detail
+
+// Tokenizes a string literal; usable in constant expressions. Sized for
+// the worst case of one token per byte.
+template<size_t N>
+[[nodiscard]] constexpr CtTokens<N - 1> lex_ct(const char (&sql)[N]) noexcept {
+    CtTokens<N - 1> out;
+    out.source = sql;
+    out.source_size = N - 1;
+    ct_detail::Lexer<N - 1>(sql, N - 1).run(out);
+    return out;
+}
+
+// Number of tokens in a literal
+template<size_t N>
+[[nodiscard]] consteval size_t count_tokens(const char (&sql)[N]) noexcept {
+    return lex_ct(sql).size();
+}
+
+// A string literal as a template argument, for tokenize_ct<"...">()
+template<size_t N>
+struct CtSql {
+    char text[N] = {};
+
+    consteval CtSql(const char (&sql)[N]) noexcept {
+        for (size_t i = 0; i < N; ++i) {
+            text[i] = sql[i];
+        }
+    }
+};
+
+// Compile-time only, sized to the token count; malformed SQL is a compile error
+template<CtSql Sql>
+[[nodiscard]] consteval auto tokenize_ct() {
+    constexpr auto all = lex_ct(Sql.text);
+    if (all.error != CtError::None) {
+        ct_detail::embedded_sql_is_malformed(all.error, all.error_offset);
+    }
+    CtTokens<all.count> out;
+    out.source = all.source;
+    out.source_size = all.source_size;
+    out.count = all.count;
+    for (size_t i = 0; i < all.count; ++i) {
+        out.tokens[i] = all.tokens[i];
+    }
+    return out;
+}
+
+// Compile-time only, one CtToken per input byte; prefer tokenize_ct<"...">()
+template<size_t N>
+[[nodiscard]] consteval CtTokens<N - 1> tokenize_ct(const char (&sql)[N]) {
+    CtTokens<N - 1> out = lex_ct(sql);
+    if (out.error != CtError::None) {
+        ct_detail::embedded_sql_is_malformed(out.error, out.error_offset);
+    }
+    return out;
+}
+
+}  // namespace db25
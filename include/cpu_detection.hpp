@@ -43,6 +43,7 @@ class CpuDetection {
 private:
     static std::atomic<SimdLevel> detected_level_;
     static std::atomic<bool> detection_done_;
+    static std::atomic<SimdLevel> level_cap_;
     
     static void detect_x86_features() noexcept {
         #if defined(__x86_64__) || defined(_M_X64)
@@ -116,7 +117,23 @@ public:
             #endif
         }
         
-        return detected_level_.load(std::memory_order_acquire);
+        SimdLevel level = detected_level_.load(std::memory_order_acquire);
+        SimdLevel cap = level_cap_.load(std::memory_order_relaxed);
+        if (level <= cap) {
+            return level;
+        }
+        return level == SimdLevel::NEON ? SimdLevel::None : cap;
+    }
+    
+    // Caps the level reported from now on, e.g. to time the scalar or SSE
+    // paths on AVX-512 hardware. Tokenizers pick their level when they are
+    // constructed. On ARM any cap below NEON selects scalar.
+    static void cap_level(SimdLevel cap) noexcept {
+        level_cap_.store(cap, std::memory_order_relaxed);
+    }
+    
+    static void clear_level_cap() noexcept {
+        level_cap_.store(SimdLevel::NEON, std::memory_order_relaxed);
     }
     
     [[nodiscard]] static bool supports_sse42() noexcept {
@@ -153,5 +170,6 @@ public:
 
 inline std::atomic<SimdLevel> CpuDetection::detected_level_{SimdLevel::None};
 inline std::atomic<bool> CpuDetection::detection_done_{false};
+inline std::atomic<SimdLevel> CpuDetection::level_cap_{SimdLevel::NEON};
 
 }  // namespace db25
\ No newline at end of file
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Dollar-quoted strings
+// =====================
+// PostgreSQL function bodies are usually written as $$ ... $$ or
+// $tag$ ... $tag$ and can run to thousands of lines. With
+// set_dollar_quotes(true), SimdTokenizer and StatementSplitter treat them
+// as one literal: the whole quote, tags included, is a single DollarString
+// token, and ';' inside it does not split statements.
+//
+// A tag is empty or an identifier without '$' (so $1 is still a
+// parameter), and a quote cannot start right after an identifier
+// character. The closing tag is found a 64-byte block at a time: only the
+// '$' positions of each block are compared against the tag.
+//
+// The body is not lexed. DollarBodyTokenizer lexes it on demand, one token
+// per next() call with positions in the enclosing input, so loaders that
+// never look inside function bodies do not pay for them.
+
+#include "simd_tokenizer.hpp"
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace db25 {
+
+struct DollarQuoteMatch {
+    size_t end = 0;             // One past the closing tag, or the input size if there is none
+    size_t newlines = 0;        // '\n' bytes inside the quote
+    size_t last_newline = 0;    // Offset of the last one (valid if newlines > 0)
+};
+
+// Length of the opening tag at `start` ("$$" = 2, "$body$" = 6), or 0 if
+// no dollar quote starts there
+[[nodiscard]] size_t dollar_quote_open(const std::byte* input, size_t size, size_t start) noexcept;
+
+// Scans for `tag` from `body_begin`, just after the opening tag
+[[nodiscard]] DollarQuoteMatch find_dollar_quote_end(const std::byte* input, size_t size, size_t body_begin,
+                                                     std::string_view tag);
+
+// Opening tag of a DollarString token's value
+[[nodiscard]] inline std::string_view dollar_quote_tag(std::string_view quote) noexcept {
+    return quote.substr(0, quote.find('$', 1) + 1);
+}
+
+// Text between the tags; runs to the end if the quote is unterminated
+[[nodiscard]] inline std::string_view dollar_quote_body(std::string_view quote) noexcept {
+    std::string_view tag = dollar_quote_tag(quote);
+    std::string_view rest = quote.substr(tag.size());
+    if (rest.size() >= tag.size() && rest.ends_with(tag)) {
+        rest.remove_suffix(tag.size());
+    }
+    return rest;
+}
+
+// Lazily lexes the body of a DollarString token; nested dollar quotes
+// become DollarString tokens of their own
+template<typename Policy = DefaultTokenizerPolicy>
+class DollarBodyTokenizer {
+private:
+    BasicSimdTokenizer<Policy> tokenizer_;
+    uint32_t line_;     // Position of the body's first byte
+    uint32_t column_;
+
+public:
+    explicit DollarBodyTokenizer(const Token& quote)
+        : DollarBodyTokenizer(quote, dollar_quote_tag(quote.value).size()) {}
+
+    [[nodiscard]] bool next(Token& out) {
+        if (!tokenizer_.next(out)) {
+            return false;
+        }
+        if constexpr (Policy::track_positions) {
+            if (out.line == 1) {
+                out.column += column_ - 1;
+            }
+            out.line += line_ - 1;
+        }
+        return true;
+    }
+
+    [[nodiscard]] std::vector<Token> tokenize() {
+        std::vector<Token> tokens;
+        Token token;
+        while (next(token)) {
+            tokens.push_back(token);
+        }
+        return tokens;
+    }
+
+private:
+    DollarBodyTokenizer(const Token& quote, size_t tag_length)
+        : tokenizer_(reinterpret_cast<const std::byte*>(quote.value.data() + tag_length),
+                     dollar_quote_body(quote.value).size())
+        , line_(quote.line)
+        , column_(quote.column + static_cast<uint32_t>(tag_length)) {
+        tokenizer_.set_dollar_quotes(true);
+    }
+};
+
+}  // namespace db25
@@ -13,6 +13,7 @@
 #include <array>
 #include <cstdint>
 #include "optimization_hints.hpp"
+#include "operator_kind.hpp"
 
 namespace db25 {
 
@@ -73,32 +74,32 @@ private:
     }();
 
 public:
-    static ALWAYS_INLINE CharClass classify(uint8_t ch) {
+    static ALWAYS_INLINE constexpr CharClass classify(uint8_t ch) {
         return char_table[ch];
     }
     
-    static ALWAYS_INLINE bool is_whitespace(uint8_t ch) {
+    static ALWAYS_INLINE constexpr bool is_whitespace(uint8_t ch) {
         return char_table[ch] == WHITESPACE || char_table[ch] == NEWLINE;
     }
     
-    static ALWAYS_INLINE bool is_identifier_start(uint8_t ch) {
+    static ALWAYS_INLINE constexpr bool is_identifier_start(uint8_t ch) {
         return char_table[ch] == ALPHA || char_table[ch] == UNDERSCORE;
     }
     
-    static ALWAYS_INLINE bool is_identifier_cont(uint8_t ch) {
+    static ALWAYS_INLINE constexpr bool is_identifier_cont(uint8_t ch) {
         CharClass c = char_table[ch];
         return c == ALPHA || c == DIGIT || c == UNDERSCORE;
     }
     
-    static ALWAYS_INLINE bool is_digit(uint8_t ch) {
+    static ALWAYS_INLINE constexpr bool is_digit(uint8_t ch) {
         return char_table[ch] == DIGIT;
     }
     
-    static ALWAYS_INLINE bool is_operator(uint8_t ch) {
+    static ALWAYS_INLINE constexpr bool is_operator(uint8_t ch) {
         return char_table[ch] == OPERATOR;
     }
     
-    static ALWAYS_INLINE bool is_delimiter(uint8_t ch) {
+    static ALWAYS_INLINE constexpr bool is_delimiter(uint8_t ch) {
         return char_table[ch] == DELIMITER;
     }
 };
@@ -114,59 +115,74 @@ public:
         BITWISE_OR = 4,    // |
         BITWISE_XOR = 5,   // ^
         BITWISE_AND = 6,   // &
-        EQUALITY = 7,      // =, !=, <>
+        EQUALITY = 7,      // ==, !=, <>
         COMPARISON = 8,    // <, <=, >, >=
         SHIFT = 9,         // <<, >>
+        // Deliberately equal to SHIFT: PostgreSQL parses << and >> as "any
+        // other operator" too, so both bind alike. Use the token's
+        // OperatorKind, not the precedence, to tell them apart.
+        OTHER_OPERATOR = SHIFT, // ->, @>, ~*, ...
         ADDITIVE = 10,     // +, -
         MULTIPLICATIVE = 11, // *, /, %
         UNARY = 12,        // !, ~, -, +
-        POSTFIX = 13       // [], (), .
+        POSTFIX = 13       // [], (), ., ::
     };
 
 private:
-    // Operator string to precedence mapping
-    struct OpEntry {
-        const char* op;
-        uint8_t len;
-        Precedence prec;
-    };
-    
-    static constexpr OpEntry operators[] = {
-        // Two-character operators first (for longest match)
-        {"<>", 2, EQUALITY},
-        {"!=", 2, EQUALITY},
-        {"<=", 2, COMPARISON},
-        {">=", 2, COMPARISON},
-        {"||", 2, LOGICAL_OR},
-        {"&&", 2, LOGICAL_AND},
-        {"<<", 2, SHIFT},
-        {">>", 2, SHIFT},
+    static_assert(OTHER_OPERATOR == SHIFT && SHIFT > COMPARISON && SHIFT < ADDITIVE);
+
+    // Precedence per OperatorKind, so lookups are one load
+    static constexpr std::array<Precedence, OPERATOR_KIND_COUNT> by_kind = []() {
+        std::array<Precedence, OPERATOR_KIND_COUNT> table{};
+        auto set = [&](OperatorKind kind, Precedence prec) {
+            table[static_cast<size_t>(kind)] = prec;
+        };
         
-        // Single-character operators
-        {"=", 1, ASSIGNMENT},
-        {"<", 1, COMPARISON},
-        {">", 1, COMPARISON},
-        {"+", 1, ADDITIVE},
-        {"-", 1, ADDITIVE},
-        {"*", 1, MULTIPLICATIVE},
-        {"/", 1, MULTIPLICATIVE},
-        {"%", 1, MULTIPLICATIVE},
-        {"&", 1, BITWISE_AND},
-        {"|", 1, BITWISE_OR},
-        {"^", 1, BITWISE_XOR},
-        {"!", 1, UNARY},
-        {"~", 1, UNARY},
-    };
+        set(OperatorKind::Equal, ASSIGNMENT);
+        set(OperatorKind::Concat, LOGICAL_OR);
+        set(OperatorKind::AndAnd, LOGICAL_AND);
+        set(OperatorKind::Pipe, BITWISE_OR);
+        set(OperatorKind::Caret, BITWISE_XOR);
+        set(OperatorKind::Ampersand, BITWISE_AND);
+        set(OperatorKind::EqualEqual, EQUALITY);
+        set(OperatorKind::NotEqual, EQUALITY);
+        set(OperatorKind::Less, COMPARISON);
+        set(OperatorKind::LessEqual, COMPARISON);
+        set(OperatorKind::Greater, COMPARISON);
+        set(OperatorKind::GreaterEqual, COMPARISON);
+        set(OperatorKind::ShiftLeft, SHIFT);
+        set(OperatorKind::ShiftRight, SHIFT);
+        set(OperatorKind::Plus, ADDITIVE);
+        set(OperatorKind::Minus, ADDITIVE);
+        set(OperatorKind::Star, MULTIPLICATIVE);
+        set(OperatorKind::Slash, MULTIPLICATIVE);
+        set(OperatorKind::Percent, MULTIPLICATIVE);
+        set(OperatorKind::Bang, UNARY);
+        set(OperatorKind::Tilde, UNARY);
+        set(OperatorKind::Cast, POSTFIX);
+        set(OperatorKind::Dot, POSTFIX);
+        
+        // PostgreSQL groups these as "any other operator": above
+        // comparison, below addition
+        for (OperatorKind kind : {OperatorKind::Arrow, OperatorKind::ArrowText,
+                                  OperatorKind::HashArrow, OperatorKind::HashArrowText,
+                                  OperatorKind::Contains, OperatorKind::ContainedBy,
+                                  OperatorKind::QuestionPipe, OperatorKind::QuestionAmpersand,
+                                  OperatorKind::AtAt, OperatorKind::RegexMatchInsensitive,
+                                  OperatorKind::RegexNotMatch, OperatorKind::RegexNotMatchInsensitive,
+                                  OperatorKind::Question}) {
+            set(kind, OTHER_OPERATOR);
+        }
+        return table;
+    }();
     
 public:
-    static Precedence get_precedence(std::string_view op) {
-        for (const auto& entry : operators) {
-            if (op.length() == entry.len && 
-                op.compare(0, entry.len, entry.op) == 0) {
-                return entry.prec;
-            }
-        }
-        return NONE;
+    static constexpr ALWAYS_INLINE Precedence get_precedence(OperatorKind kind) {
+        return by_kind[static_cast<size_t>(kind)];
+    }
+    
+    static constexpr Precedence get_precedence(std::string_view op) {
+        return get_precedence(operator_kind(op));
     }
 };
 
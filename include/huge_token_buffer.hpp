@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Huge-input token storage
+// ========================
+// For inputs that produce tens of millions of tokens, std::vector<Token>
+// copies the whole array on every reallocation and drags the output
+// through the cache although nobody reads it until lexing is done.
+//
+// HugeTokenBuffer keeps tokens in an anonymous mapping with transparent
+// huge pages (MADV_HUGEPAGE: 2 MiB TLB entries instead of 4 KiB) that
+// grows with mremap, which moves page table entries instead of bytes.
+// stream_back() writes a token with non-temporal stores that bypass the
+// cache. tokenize_huge() drives the tokenizer into such a buffer and
+// prefetches the input ahead of the lexer.
+//
+// Without mmap/mremap the buffer falls back to realloc.
+
+#include "simd_tokenizer.hpp"
+#include <cstddef>
+#include <cstring>
+#include <span>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <immintrin.h>
+    #define DB25_HAVE_STREAMING_STORES 1
+#endif
+
+namespace db25 {
+
+struct HugeBufferOptions {
+    bool streaming_stores = true;       // Non-temporal token stores (x86)
+    size_t prefetch_distance = 2048;    // Input bytes prefetched ahead of the lexer (0 = off)
+};
+
+// Move-only. Throws std::system_error if the mapping cannot be created or grown.
+class HugeTokenBuffer {
+private:
+    Token* data_ = nullptr;
+    size_t size_ = 0;
+    size_t capacity_ = 0;       // Tokens
+    bool huge_pages_ = true;
+
+    void grow(size_t min_capacity);
+    void release() noexcept;
+
+public:
+    // `huge_pages`: MADV_HUGEPAGE on the mapping (best effort, needs THP)
+    explicit HugeTokenBuffer(bool huge_pages = true) noexcept : huge_pages_(huge_pages) {}
+    ~HugeTokenBuffer() { release(); }
+
+    HugeTokenBuffer(HugeTokenBuffer&& other) noexcept;
+    HugeTokenBuffer& operator=(HugeTokenBuffer&& other) noexcept;
+    HugeTokenBuffer(const HugeTokenBuffer&) = delete;
+    HugeTokenBuffer& operator=(const HugeTokenBuffer&) = delete;
+
+    void reserve(size_t tokens) {
+        if (tokens > capacity_) grow(tokens);
+    }
+
+    void push_back(const Token& token) {
+        if (size_ == capacity_) grow(size_ + 1);
+        std::memcpy(static_cast<void*>(data_ + size_), &token, sizeof(Token));
+        ++size_;
+    }
+
+    // Non-temporal store; call fence() before the tokens are read
+    void stream_back(const Token& token) {
+        if (size_ == capacity_) grow(size_ + 1);
+#ifdef DB25_HAVE_STREAMING_STORES
+        const auto* src = reinterpret_cast<const __m128i*>(&token);
+        auto* dst = reinterpret_cast<__m128i*>(data_ + size_);
+        _mm_stream_si128(dst, _mm_loadu_si128(src));
+        _mm_stream_si128(dst + 1, _mm_loadu_si128(src + 1));
+#else
+        std::memcpy(static_cast<void*>(data_ + size_), &token, sizeof(Token));
+#endif
+        ++size_;
+    }
+
+    // Orders preceding streaming stores before later loads and stores
+    void fence() noexcept {
+#ifdef DB25_HAVE_STREAMING_STORES
+        _mm_sfence();
+#endif
+    }
+
+    void clear() noexcept { size_ = 0; }
+
+    [[nodiscard]] std::span<const Token> tokens() const noexcept { return {data_, size_}; }
+    [[nodiscard]] const Token& operator[](size_t i) const noexcept { return data_[i]; }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+};
+
+static_assert(sizeof(Token) == 32, "stream_back() writes tokens as two 16-byte stores");
+
+// Appends the tokens of `input` to `out`; returns the number appended
+size_t tokenize_huge(const std::byte* input, size_t size, HugeTokenBuffer& out,
+                     const HugeBufferOptions& options = {});
+
+}  // namespace db25
@@ -236,7 +236,41 @@ enum class Keyword : uint16_t {
     TRANSACTION = 205,
     UNCOMMITTED = 206,
     SERIALIZABLE = 207,
-    AUTHORIZATION = 208
+    AUTHORIZATION = 208,
+    ORDER_BY = 209,
+    GROUP_BY = 210,
+    PARTITION_BY = 211,
+    UNION_ALL = 212,
+    INTERSECT_ALL = 213,
+    EXCEPT_ALL = 214,
+    INNER_JOIN = 215,
+    CROSS_JOIN = 216,
+    NATURAL_JOIN = 217,
+    LEFT_JOIN = 218,
+    LEFT_OUTER_JOIN = 219,
+    RIGHT_JOIN = 220,
+    RIGHT_OUTER_JOIN = 221,
+    FULL_JOIN = 222,
+    FULL_OUTER_JOIN = 223,
+    IS_NULL = 224,
+    IS_NOT_NULL = 225,
+    IS_DISTINCT_FROM = 226,
+    IS_NOT_DISTINCT_FROM = 227,
+    NOT_NULL = 228,
+    NOT_IN = 229,
+    NOT_LIKE = 230,
+    NOT_ILIKE = 231,
+    NOT_BETWEEN = 232,
+    NOT_EXISTS = 233,
+    PRIMARY_KEY = 234,
+    FOREIGN_KEY = 235,
+    INSERT_INTO = 236,
+    DELETE_FROM = 237,
+    ON_CONFLICT = 238,
+    DO_NOTHING = 239,
+    NULLS_FIRST = 240,
+    NULLS_LAST = 241,
+    WITH_RECURSIVE = 242
 };
 
 struct KeywordEntry {
@@ -536,6 +570,80 @@ template<typename Processor>
     return false;
 }
 
+// Multi-word keywords, fused into one Keyword token (spanning any
+// whitespace and comments between the words) when the tokenizer's
+// compound stage is enabled. IDs follow the single keywords.
+inline constexpr size_t COMPOUND_KEYWORD_MAX_PARTS = 4;
+inline constexpr Keyword FIRST_COMPOUND_KEYWORD = Keyword::ORDER_BY;
+
+struct CompoundKeywordEntry {
+    std::string_view text;      // Canonical spelling, words separated by one space
+    Keyword id;
+    uint8_t part_count;
+    std::array<Keyword, COMPOUND_KEYWORD_MAX_PARTS> parts;
+};
+
+inline constexpr std::array<CompoundKeywordEntry, 34> COMPOUND_KEYWORDS = {{
+    {"ORDER BY", Keyword::ORDER_BY, 2, {Keyword::ORDER, Keyword::BY}},
+    {"GROUP BY", Keyword::GROUP_BY, 2, {Keyword::GROUP, Keyword::BY}},
+    {"PARTITION BY", Keyword::PARTITION_BY, 2, {Keyword::PARTITION, Keyword::BY}},
+    {"UNION ALL", Keyword::UNION_ALL, 2, {Keyword::UNION, Keyword::ALL}},
+    {"INTERSECT ALL", Keyword::INTERSECT_ALL, 2, {Keyword::INTERSECT, Keyword::ALL}},
+    {"EXCEPT ALL", Keyword::EXCEPT_ALL, 2, {Keyword::EXCEPT, Keyword::ALL}},
+    {"INNER JOIN", Keyword::INNER_JOIN, 2, {Keyword::INNER, Keyword::JOIN}},
+    {"CROSS JOIN", Keyword::CROSS_JOIN, 2, {Keyword::CROSS, Keyword::JOIN}},
+    {"NATURAL JOIN", Keyword::NATURAL_JOIN, 2, {Keyword::NATURAL, Keyword::JOIN}},
+    {"LEFT JOIN", Keyword::LEFT_JOIN, 2, {Keyword::LEFT, Keyword::JOIN}},
+    {"LEFT OUTER JOIN", Keyword::LEFT_OUTER_JOIN, 3, {Keyword::LEFT, Keyword::OUTER, Keyword::JOIN}},
+    {"RIGHT JOIN", Keyword::RIGHT_JOIN, 2, {Keyword::RIGHT, Keyword::JOIN}},
+    {"RIGHT OUTER JOIN", Keyword::RIGHT_OUTER_JOIN, 3, {Keyword::RIGHT, Keyword::OUTER, Keyword::JOIN}},
+    {"FULL JOIN", Keyword::FULL_JOIN, 2, {Keyword::FULL, Keyword::JOIN}},
+    {"FULL OUTER JOIN", Keyword::FULL_OUTER_JOIN, 3, {Keyword::FULL, Keyword::OUTER, Keyword::JOIN}},
+    {"IS NULL", Keyword::IS_NULL, 2, {Keyword::IS, Keyword::KW_NULL}},
+    {"IS NOT NULL", Keyword::IS_NOT_NULL, 3, {Keyword::IS, Keyword::NOT, Keyword::KW_NULL}},
+    {"IS DISTINCT FROM", Keyword::IS_DISTINCT_FROM, 3, {Keyword::IS, Keyword::DISTINCT, Keyword::FROM}},
+    {"IS NOT DISTINCT FROM", Keyword::IS_NOT_DISTINCT_FROM, 4, {Keyword::IS, Keyword::NOT, Keyword::DISTINCT, Keyword::FROM}},
+    {"NOT NULL", Keyword::NOT_NULL, 2, {Keyword::NOT, Keyword::KW_NULL}},
+    {"NOT IN", Keyword::NOT_IN, 2, {Keyword::NOT, Keyword::IN}},
+    {"NOT LIKE", Keyword::NOT_LIKE, 2, {Keyword::NOT, Keyword::LIKE}},
+    {"NOT ILIKE", Keyword::NOT_ILIKE, 2, {Keyword::NOT, Keyword::ILIKE}},
+    {"NOT BETWEEN", Keyword::NOT_BETWEEN, 2, {Keyword::NOT, Keyword::BETWEEN}},
+    {"NOT EXISTS", Keyword::NOT_EXISTS, 2, {Keyword::NOT, Keyword::EXISTS}},
+    {"PRIMARY KEY", Keyword::PRIMARY_KEY, 2, {Keyword::PRIMARY, Keyword::KEY}},
+    {"FOREIGN KEY", Keyword::FOREIGN_KEY, 2, {Keyword::FOREIGN, Keyword::KEY}},
+    {"INSERT INTO", Keyword::INSERT_INTO, 2, {Keyword::INSERT, Keyword::INTO}},
+    {"DELETE FROM", Keyword::DELETE_FROM, 2, {Keyword::DELETE, Keyword::FROM}},
+    {"ON CONFLICT", Keyword::ON_CONFLICT, 2, {Keyword::ON, Keyword::CONFLICT}},
+    {"DO NOTHING", Keyword::DO_NOTHING, 2, {Keyword::DO, Keyword::NOTHING}},
+    {"NULLS FIRST", Keyword::NULLS_FIRST, 2, {Keyword::NULLS, Keyword::FIRST}},
+    {"NULLS LAST", Keyword::NULLS_LAST, 2, {Keyword::NULLS, Keyword::LAST}},
+    {"WITH RECURSIVE", Keyword::WITH_RECURSIVE, 2, {Keyword::WITH, Keyword::RECURSIVE}}
+}};
+
+[[nodiscard]] constexpr bool is_compound_keyword(Keyword kw) noexcept {
+    return static_cast<uint16_t>(kw) >= static_cast<uint16_t>(FIRST_COMPOUND_KEYWORD);
+}
+
+struct CompoundMatch {
+    Keyword keyword;            // Compound spelled exactly by the words (UNKNOWN if none)
+    bool extensible;            // A longer compound starts with the words
+};
+
+[[nodiscard]] constexpr CompoundMatch match_compound_keyword(const Keyword* parts, size_t count) noexcept {
+    CompoundMatch match{Keyword::UNKNOWN, false};
+    for (const auto& entry : COMPOUND_KEYWORDS) {
+        if (entry.part_count < count || !std::equal(parts, parts + count, entry.parts.begin())) {
+            continue;
+        }
+        if (entry.part_count == count) {
+            match.keyword = entry.id;
+        } else {
+            match.extensible = true;
+        }
+    }
+    return match;
+}
+
 // Keyword name lookup
 [[nodiscard]] inline std::string_view keyword_name(Keyword kw) noexcept {
     if (kw == Keyword::UNKNOWN) return "UNKNOWN";
@@ -543,7 +651,282 @@ template<typename Processor>
     if (idx < KEYWORDS.size()) {
         return KEYWORDS[idx].text;
     }
+    idx -= KEYWORDS.size();
+    if (idx < COMPOUND_KEYWORDS.size()) {
+        return COMPOUND_KEYWORDS[idx].text;
+    }
     return "INVALID";
 }
 
+// Keyword attribute bits (KEYWORD_ATTRIBUTES)
+struct KeywordAttr {
+    enum : uint16_t {
+        RESERVED        = 1 << 0,   // Never an identifier
+        CONTEXTUAL      = 1 << 1,   // Identifier outside its clause
+        TYPE_NAME       = 1 << 2,   // Starts or continues a data type
+        CLAUSE_START    = 1 << 3,   // Begins a clause of a statement
+        STATEMENT_START = 1 << 4,   // Begins a statement
+        JOIN            = 1 << 5,   // Part of a join operator
+        FUNCTION        = 1 << 6,   // Function-call syntax (name followed by '(')
+        OPERATOR        = 1 << 7,   // Infix or prefix word operator
+        LITERAL         = 1 << 8,   // Literal value
+        COMPOUND_HEAD   = 1 << 9,   // First word of a COMPOUND_KEYWORDS entry
+    };
+};
+
+// Indexed by Keyword; UNKNOWN (non-keyword tokens) has no bits
+inline constexpr std::array<uint16_t, 243> KEYWORD_ATTRIBUTES = {{
+    0x0000,  // UNKNOWN
+    0x0002,  // AS
+    0x0001,  // BY
+    0x0202,  // DO
+    0x0002,  // IF
+    0x0082,  // IN
+    0x0282,  // IS
+    0x0002,  // NO
+    0x0002,  // OF
+    0x020a,  // ON
+    0x0081,  // OR
+    0x0002,  // TO
+    0x0000,  // ADD
+    0x0001,  // ALL
+    0x0081,  // AND
+    0x0001,  // ASC
+    0x0001,  // END
+    0x0002,  // FOR
+    0x0000,  // GIN
+    0x0004,  // INT
+    0x0001,  // KEY
+    0x0281,  // NOT
+    0x0002,  // ROW
+    0x000a,  // SET
+    0x0004,  // BLOB
+    0x0004,  // BOOL
+    0x0000,  // BRIN
+    0x0001,  // KW_CASE
+    0x0040,  // CAST
+    0x0004,  // CHAR
+    0x0040,  // CUBE
+    0x0000,  // DATA
+    0x0004,  // DATE
+    0x0001,  // DESC
+    0x0011,  // DROP
+    0x0002,  // EACH
+    0x0001,  // ELSE
+    0x0009,  // FROM
+    0x0221,  // FULL
+    0x0000,  // GIST
+    0x0000,  // HASH
+    0x000a,  // INTO
+    0x0021,  // JOIN
+    0x0004,  // JSON
+    0x0002,  // LAST
+    0x0221,  // LEFT
+    0x0082,  // LIKE
+    0x0002,  // NEXT
+    0x0101,  // KW_NULL
+    0x0002,  // ONLY
+    0x0002,  // OVER
+    0x0002,  // PLAN
+    0x0002,  // READ
+    0x0004,  // REAL
+    0x0002,  // ROWS
+    0x0000,  // SETS
+    0x0002,  // TEMP
+    0x0004,  // TEXT
+    0x0001,  // THEN
+    0x0002,  // TIES
+    0x0006,  // TIME
+    0x0101,  // KW_TRUE
+    0x0000,  // TYPE
+    0x0001,  // VIEW
+    0x0001,  // WHEN
+    0x021a,  // WITH
+    0x0002,  // WORK
+    0x0002,  // ZONE
+    0x0002,  // AFTER
+    0x0011,  // ALTER
+    0x0040,  // ARRAY
+    0x0011,  // BEGIN
+    0x0000,  // BTREE
+    0x0004,  // BYTEA
+    0x0002,  // CACHE
+    0x0000,  // CHAIN
+    0x0002,  // CHECK
+    0x0223,  // CROSS
+    0x0002,  // CYCLE
+    0x0002,  // DEPTH
+    0x0101,  // KW_FALSE
+    0x000a,  // FETCH
+    0x0002,  // FIRST
+    0x0004,  // FLOAT
+    0x0209,  // GROUP
+    0x0082,  // ILIKE
+    0x0001,  // INDEX
+    0x0221,  // INNER
+    0x0004,  // JSONB
+    0x0002,  // LEVEL
+    0x000a,  // LIMIT
+    0x0002,  // LOCAL
+    0x0202,  // NULLS
+    0x0209,  // ORDER
+    0x0021,  // OUTER
+    0x0000,  // OWNER
+    0x0002,  // PIVOT
+    0x0002,  // QUERY
+    0x0002,  // RANGE
+    0x0221,  // RIGHT
+    0x0002,  // START
+    0x0001,  // TABLE
+    0x0209,  // UNION
+    0x000a,  // USING
+    0x0009,  // WHERE
+    0x0002,  // WRITE
+    0x0002,  // ACTION
+    0x0002,  // ALWAYS
+    0x0012,  // ATTACH
+    0x0002,  // BEFORE
+    0x0004,  // BIGINT
+    0x0004,  // BINARY
+    0x0000,  // COLUMN
+    0x0011,  // COMMIT
+    0x0011,  // CREATE
+    0x0211,  // DELETE
+    0x0012,  // DETACH
+    0x0004,  // DOUBLE
+    0x0082,  // ESCAPE
+    0x0209,  // EXCEPT
+    0x0042,  // EXISTS
+    0x0002,  // FILTER
+    0x0002,  // GROUPS
+    0x0009,  // HAVING
+    0x0211,  // INSERT
+    0x000a,  // OFFSET
+    0x0000,  // OPTION
+    0x0002,  // OTHERS
+    0x0012,  // PRAGMA
+    0x0000,  // RENAME
+    0x0040,  // ROLLUP
+    0x0002,  // SCHEMA
+    0x0002,  // SEARCH
+    0x0019,  // SELECT
+    0x0000,  // SPGIST
+    0x0002,  // STORED
+    0x0001,  // UNIQUE
+    0x0011,  // UPDATE
+    0x0012,  // VACUUM
+    0x001a,  // VALUES
+    0x000a,  // WINDOW
+    0x0002,  // WITHIN
+    0x0012,  // ANALYZE
+    0x0082,  // BETWEEN
+    0x0004,  // BOOLEAN
+    0x0002,  // BREADTH
+    0x0002,  // CASCADE
+    0x0002,  // COLLATE
+    0x0002,  // CURRENT
+    0x0004,  // DECIMAL
+    0x0002,  // KW_DEFAULT
+    0x0002,  // EXCLUDE
+    0x0012,  // EXPLAIN
+    0x0042,  // EXTRACT
+    0x0201,  // FOREIGN
+    0x0002,  // INSTEAD
+    0x0004,  // INTEGER
+    0x0022,  // LATERAL
+    0x0222,  // NATURAL
+    0x0002,  // NOTHING
+    0x0004,  // NUMERIC
+    0x0201,  // PRIMARY
+    0x0012,  // REINDEX
+    0x0012,  // RELEASE
+    0x0002,  // REPLACE
+    0x0000,  // RESTART
+    0x0002,  // SESSION
+    0x0002,  // TRIGGER
+    0x0002,  // UNPIVOT
+    0x0004,  // VARCHAR
+    0x0004,  // VARYING
+    0x0002,  // VIRTUAL
+    0x0002,  // CASCADED
+    0x0002,  // CONFLICT
+    0x0002,  // DATABASE
+    0x0001,  // DISTINCT
+    0x0040,  // GROUPING
+    0x0006,  // INTERVAL
+    0x0002,  // MAXVALUE
+    0x0002,  // MINVALUE
+    0x0002,  // RESTRICT
+    0x0011,  // ROLLBACK
+    0x0002,  // SEQUENCE
+    0x0004,  // SMALLINT
+    0x0004,  // CHARACTER
+    0x0002,  // COMMITTED
+    0x0002,  // FOLLOWING
+    0x0002,  // GENERATED
+    0x0002,  // INCREMENT
+    0x0209,  // INTERSECT
+    0x0002,  // ISOLATION
+    0x0202,  // PARTITION
+    0x0002,  // PRECEDING
+    0x0004,  // PRECISION
+    0x0002,  // RECURSIVE
+    0x000a,  // RETURNING
+    0x0012,  // SAVEPOINT
+    0x0002,  // STATEMENT
+    0x0002,  // TEMPORARY
+    0x0004,  // TIMESTAMP
+    0x0002,  // UNBOUNDED
+    0x0002,  // CONSTRAINT
+    0x0002,  // DEFERRABLE
+    0x0001,  // REFERENCES
+    0x0002,  // REPEATABLE
+    0x0001,  // TRANSACTION
+    0x0002,  // UNCOMMITTED
+    0x0002,  // SERIALIZABLE
+    0x0002,  // AUTHORIZATION
+    0x0009,  // ORDER_BY
+    0x0009,  // GROUP_BY
+    0x0001,  // PARTITION_BY
+    0x0009,  // UNION_ALL
+    0x0009,  // INTERSECT_ALL
+    0x0009,  // EXCEPT_ALL
+    0x0021,  // INNER_JOIN
+    0x0021,  // CROSS_JOIN
+    0x0021,  // NATURAL_JOIN
+    0x0021,  // LEFT_JOIN
+    0x0021,  // LEFT_OUTER_JOIN
+    0x0021,  // RIGHT_JOIN
+    0x0021,  // RIGHT_OUTER_JOIN
+    0x0021,  // FULL_JOIN
+    0x0021,  // FULL_OUTER_JOIN
+    0x0081,  // IS_NULL
+    0x0081,  // IS_NOT_NULL
+    0x0081,  // IS_DISTINCT_FROM
+    0x0081,  // IS_NOT_DISTINCT_FROM
+    0x0081,  // NOT_NULL
+    0x0081,  // NOT_IN
+    0x0081,  // NOT_LIKE
+    0x0081,  // NOT_ILIKE
+    0x0081,  // NOT_BETWEEN
+    0x0081,  // NOT_EXISTS
+    0x0001,  // PRIMARY_KEY
+    0x0001,  // FOREIGN_KEY
+    0x0011,  // INSERT_INTO
+    0x0011,  // DELETE_FROM
+    0x0009,  // ON_CONFLICT
+    0x0001,  // DO_NOTHING
+    0x0001,  // NULLS_FIRST
+    0x0001,  // NULLS_LAST
+    0x0019   // WITH_RECURSIVE
+}};
+
+[[nodiscard]] constexpr uint16_t keyword_attributes(Keyword kw) noexcept {
+    return KEYWORD_ATTRIBUTES[static_cast<size_t>(kw)];
+}
+
+[[nodiscard]] constexpr bool keyword_has(Keyword kw, uint16_t attributes) noexcept {
+    return (KEYWORD_ATTRIBUTES[static_cast<size_t>(kw)] & attributes) != 0;
+}
+
 }  // namespace db25
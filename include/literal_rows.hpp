@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Bulk literal rows
+// =================
+// Dump-style INSERT ... VALUES (...),(...),... statements and long IN
+// lists are mostly commas, parentheses and literals: two or three tokens
+// per value. With set_literal_rows() enabled the tokenizer recognizes a
+// run of homogeneous literal tuples after VALUES (or the list after IN /
+// NOT IN) and emits it as ONE TokenType::LiteralList token. The row/field
+// structure goes into a LiteralRowIndex at 8 bytes per field, so a loader
+// reads the values without any per-value tokens.
+//
+// A field is a number (optionally signed), a single-quoted string ('' is
+// an escaped quote), or NULL / TRUE / FALSE / DEFAULT. Every row must have
+// the field count of the first. The list ends after the last complete row
+// that satisfies this; anything after it (an expression, a comment, a row
+// of a different width) is lexed normally.
+//
+// Field boundaries are found with the 64-byte block classifier: quotes,
+// commas and parentheses become bit masks and only those positions are
+// visited, so long strings are skipped a block at a time.
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace db25 {
+
+// One value; the first byte tells its kind (' string, digit/sign/. number, else keyword)
+struct LiteralField {
+    uint32_t offset;    // From LiteralList::begin
+    uint32_t length;
+};
+
+struct LiteralList {
+    size_t begin = 0;           // Byte offset of the first '('
+    size_t end = 0;             // One past the last ')'
+    uint32_t rows = 0;
+    uint32_t fields_per_row = 0;
+    size_t first_field = 0;     // Index into LiteralRowIndex::fields
+};
+
+struct LiteralRowIndex {
+    std::vector<LiteralList> lists;     // One per LiteralList token; the token's symbol_id is its index + 1
+    std::vector<LiteralField> fields;   // Row-major, all lists back to back
+
+    void clear() noexcept {
+        lists.clear();
+        fields.clear();
+    }
+
+    // List of a LiteralList token, by its symbol_id (never 0)
+    [[nodiscard]] const LiteralList& list(uint32_t symbol_id) const noexcept {
+        return lists[symbol_id - 1];
+    }
+
+    [[nodiscard]] std::span<const LiteralField> row(const LiteralList& list, size_t r) const noexcept {
+        return {fields.data() + list.first_field + r * list.fields_per_row, list.fields_per_row};
+    }
+
+    [[nodiscard]] static std::string_view text(std::string_view source, const LiteralList& list,
+                                               const LiteralField& field) noexcept {
+        return source.substr(list.begin + field.offset, field.length);
+    }
+};
+
+struct LiteralRowsMatch {
+    size_t end = 0;             // One past the list; equals `start` if nothing matched
+    size_t newlines = 0;        // '\n' bytes inside the list
+    size_t last_newline = 0;    // Offset of the last one (valid if newlines > 0)
+};
+
+// Scans literal tuples starting at the '(' at `start`; at most `max_rows`
+// rows (1 for IN lists). On a match appends one LiteralList and its fields.
+[[nodiscard]] LiteralRowsMatch scan_literal_rows(const std::byte* input, size_t size, size_t start,
+                                                 size_t max_rows, LiteralRowIndex& index);
+
+}  // namespace db25
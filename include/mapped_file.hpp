@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Zero-copy file tokenization
+// ===========================
+// Files are memory-mapped read-only and tokenized in place, so token
+// string_views point straight into the mapping. The mapping lives as long
+// as the owning MappedFile / TokenizedFile handle.
+
+#include "simd_tokenizer.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace db25 {
+
+struct MapOptions {
+    bool sequential = true;    // MADV_SEQUENTIAL: aggressive read-ahead, early reclaim
+    bool huge_pages = false;   // MADV_HUGEPAGE (best effort, needs THP for file mappings)
+    bool populate = false;     // MAP_POPULATE: prefault the whole file up front
+};
+
+// Read-only memory mapping of a whole file. Move-only; unmaps on destruction.
+// Throws std::system_error if the file cannot be opened or mapped.
+class MappedFile {
+private:
+    const std::byte* data_ = nullptr;
+    size_t size_ = 0;
+    std::vector<std::byte> fallback_;   // Platforms without mmap
+
+    void unmap() noexcept;
+
+public:
+    MappedFile() noexcept = default;
+    explicit MappedFile(const std::filesystem::path& path, MapOptions options = {});
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    [[nodiscard]] const std::byte* data() const noexcept { return data_; }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] std::string_view text() const noexcept {
+        return {reinterpret_cast<const char*>(data_), size_};
+    }
+};
+
+// Tokens of a mapped file; their views stay valid while this handle lives
+class TokenizedFile {
+private:
+    MappedFile file_;
+    std::vector<Token> tokens_;
+
+public:
+    TokenizedFile(MappedFile file, std::vector<Token> tokens) noexcept
+        : file_(std::move(file)), tokens_(std::move(tokens)) {}
+
+    [[nodiscard]] std::span<const Token> tokens() const noexcept { return tokens_; }
+    [[nodiscard]] std::string_view source() const noexcept { return file_.text(); }
+    [[nodiscard]] const MappedFile& file() const noexcept { return file_; }
+};
+
+// Maps `path` and tokenizes it without copying the contents
+[[nodiscard]] TokenizedFile tokenize_file(const std::filesystem::path& path, MapOptions options = {});
+
+}  // namespace db25
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Numeric literal values
+// ======================
+// Converts the text of a Number token (digits [. digits] [e [+-] digits])
+// into an exact mantissa/exponent pair plus the nearest double. The
+// integer and fraction digit runs are converted up to 16 digits at a time
+// (AVX-512 masked load + maddubs/madd; a multiply-accumulate loop elsewhere).
+// Doubles use the exact fast path (mantissa <= 2^53, |exponent| <= 22) and
+// fall back to std::from_chars otherwise.
+
+#include "simd_architecture.hpp"
+#include "optimization_hints.hpp"
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace db25 {
+
+enum class NumericKind : uint8_t {
+    Integer,    // 42
+    Decimal,    // 12.50 (NUMERIC: mantissa 1250, scale 2)
+    Float       // 1.5e-3
+};
+
+// The mantissa does not fit in int64 (more than 19 significant digits or
+// above INT64_MAX); mantissa/exponent are then unset and only `value` is usable
+inline constexpr uint8_t NUMERIC_OVERFLOW = 0x01;
+
+struct NumericValue {
+    uint64_t token_index;   // Index of the Number token in the token stream
+    int64_t mantissa;       // Significant digits without the '.', e.g. 12.50 -> 1250
+    double value;           // Nearest double
+    int32_t exponent;       // value = mantissa * 10^exponent
+    NumericKind kind;
+    uint8_t flags;
+
+    [[nodiscard]] bool overflow() const noexcept { return (flags & NUMERIC_OVERFLOW) != 0; }
+
+    // Exact integer value (Integer kind without overflow)
+    [[nodiscard]] int64_t integer() const noexcept { return mantissa; }
+
+    // Digits after the decimal point for Decimal literals
+    [[nodiscard]] int32_t scale() const noexcept { return -exponent; }
+};
+
+static_assert(sizeof(NumericValue) == 32, "NumericValue should stay one Token wide");
+
+namespace numeric_detail {
+
+inline constexpr size_t MAX_EXACT_DIGITS = 19;
+
+inline constexpr uint64_t POW10[] = {
+    1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+    100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+    10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+    100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+inline uint64_t accumulate_digits(const uint8_t* digits, size_t count, uint64_t value = 0) noexcept {
+    for (size_t i = 0; i < count; ++i) {
+        value = value * 10 + (digits[i] - '0');
+    }
+    return value;
+}
+
+}  // namespace numeric_detail
+
+// Value of `count` (<= 19) ASCII digits, most significant first
+template<typename Processor>
+[[nodiscard]] inline uint64_t convert_digits(Processor, const uint8_t* digits, size_t count) noexcept {
+    return numeric_detail::accumulate_digits(digits, count);
+}
+
+#if (defined(__x86_64__) || defined(_M_X64)) && defined(__AVX512BW__) && defined(__AVX512VL__)
+// Up to 16 digits per step: a fault-suppressing masked load never touches
+// bytes past the literal, pshufb right-aligns the digits, then
+// maddubs/madd/packus/madd fold pairs, quads and octets.
+[[nodiscard]] inline uint64_t convert_digits(AVX512Processor, const uint8_t* digits, size_t count) noexcept {
+    alignas(16) static constexpr int8_t align_table[32] = {
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+    };
+    
+    uint64_t high = 0;
+    if (count > 16) UNLIKELY {
+        high = numeric_detail::accumulate_digits(digits, count - 16);
+        digits += count - 16;
+        count = 16;
+    }
+    
+    __m128i v = _mm_maskz_loadu_epi8(static_cast<__mmask16>((1u << count) - 1), digits);
+    v = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+    v = _mm_shuffle_epi8(v, _mm_loadu_si128(reinterpret_cast<const __m128i*>(align_table + count)));
+    v = _mm_maddubs_epi16(v, _mm_set_epi8(1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10));
+    v = _mm_madd_epi16(v, _mm_set_epi16(1, 100, 1, 100, 1, 100, 1, 100));
+    v = _mm_packus_epi32(v, v);
+    v = _mm_madd_epi16(v, _mm_set_epi16(1, 10000, 1, 10000, 1, 10000, 1, 10000));
+    uint64_t upper = static_cast<uint32_t>(_mm_cvtsi128_si32(v));
+    uint64_t lower = static_cast<uint32_t>(_mm_extract_epi32(v, 1));
+    return high * 10000000000000000ULL + upper * 100000000ULL + lower;
+}
+#endif
+
+// Parses the text of a Number token. `token_index` is left at 0.
+template<typename Processor>
+[[nodiscard]] NumericValue parse_numeric_literal(Processor processor, std::string_view text) noexcept {
+    using namespace numeric_detail;
+
+    NumericValue result{};
+    const auto* p = reinterpret_cast<const uint8_t*>(text.data());
+    const size_t size = text.size();
+
+    size_t int_end = 0;
+    while (int_end < size && p[int_end] >= '0' && p[int_end] <= '9') {
+        ++int_end;
+    }
+    size_t frac_begin = int_end;
+    size_t frac_end = int_end;
+    if (frac_end < size && p[frac_end] == '.') {
+        frac_begin = frac_end = int_end + 1;
+        while (frac_end < size && p[frac_end] >= '0' && p[frac_end] <= '9') {
+            ++frac_end;
+        }
+    }
+
+    int64_t exponent_part = 0;
+    bool has_exponent = frac_end < size && (p[frac_end] == 'e' || p[frac_end] == 'E');
+    if (has_exponent) {
+        size_t i = frac_end + 1;
+        bool negative = false;
+        if (i < size && (p[i] == '+' || p[i] == '-')) {
+            negative = p[i] == '-';
+            ++i;
+        }
+        for (; i < size && p[i] >= '0' && p[i] <= '9'; ++i) {
+            if (exponent_part < 100000) {
+                exponent_part = exponent_part * 10 + (p[i] - '0');
+            }
+        }
+        if (negative) {
+            exponent_part = -exponent_part;
+        }
+    }
+
+    result.kind = has_exponent ? NumericKind::Float
+                : frac_begin != int_end ? NumericKind::Decimal
+                : NumericKind::Integer;
+
+    // Significant digits: integer part then fraction, leading zeros dropped
+    size_t int_begin = 0;
+    while (int_begin < int_end && p[int_begin] == '0') {
+        ++int_begin;
+    }
+    size_t frac_skip = frac_begin;
+    if (int_begin == int_end) {
+        while (frac_skip < frac_end && p[frac_skip] == '0') {
+            ++frac_skip;
+        }
+    }
+    size_t int_digits = int_end - int_begin;
+    size_t frac_digits = frac_end - frac_skip;
+    size_t digits = int_digits + frac_digits;
+
+    // Integer and fraction runs convert separately: int * 10^frac + frac
+    uint64_t mantissa = 0;
+    bool overflow = digits > MAX_EXACT_DIGITS;
+    if (!overflow) {
+        uint64_t integer = int_digits > 0 ? convert_digits(processor, p + int_begin, int_digits) : 0;
+        uint64_t fraction = frac_digits > 0 ? convert_digits(processor, p + frac_skip, frac_digits) : 0;
+        // int * 10^frac + frac <= INT64_MAX, checked without wrapping
+        constexpr auto MANTISSA_MAX = static_cast<uint64_t>(std::numeric_limits<int64_t>::max());
+        overflow = fraction > MANTISSA_MAX || integer > (MANTISSA_MAX - fraction) / POW10[frac_digits];
+        if (!overflow) {
+            mantissa = integer * POW10[frac_digits] + fraction;
+        }
+    }
+
+    int64_t exponent = exponent_part - static_cast<int64_t>(frac_end - frac_begin);
+    if (overflow) {
+        result.flags |= NUMERIC_OVERFLOW;
+    } else {
+        result.mantissa = static_cast<int64_t>(mantissa);
+        result.exponent = static_cast<int32_t>(exponent);
+    }
+
+    // Exact double fast path (Clinger): both operands are exact doubles
+    static constexpr double powers[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    if (!overflow && exponent == 0) {
+        result.value = static_cast<double>(mantissa);   // Single rounding step
+    } else if (!overflow && mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22) LIKELY {
+        double m = static_cast<double>(mantissa);
+        result.value = exponent < 0 ? m / powers[-exponent] : m * powers[exponent];
+    } else if (mantissa == 0 && !overflow) {
+        result.value = 0.0;
+    } else {
+        double value = 0.0;
+        auto [ptr, ec] = std::from_chars(text.data(), text.data() + size, value);
+        (void)ptr;
+        if (ec == std::errc::result_out_of_range) {
+            // Digits before the decimal point decide overflow vs underflow
+            value = static_cast<int64_t>(digits) + exponent > 0 ? std::numeric_limits<double>::infinity() : 0.0;
+        }
+        result.value = value;
+    }
+
+    return result;
+}
+
+[[nodiscard]] inline NumericValue parse_numeric_literal(std::string_view text) noexcept {
+    return SimdDispatcher{}.dispatch([&](auto processor) {
+        return parse_numeric_literal(processor, text);
+    });
+}
+
+}  // namespace db25
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Operator kinds
+// ==============
+// Dense IDs for operator and delimiter spellings, assigned by the tokenizer
+// (stored in Token::reserved) so the parser never compares operator text.
+// match_operator() is the tokenizer's longest-match rule: one table lookup
+// for the character pair, one compare for the few three-character forms.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace db25 {
+
+enum class OperatorKind : uint8_t {
+    None,               // Not an operator or delimiter token
+
+    // Arithmetic and bitwise
+    Plus,               // +
+    Minus,              // -
+    Star,               // *
+    Slash,              // /
+    Percent,            // %
+    Caret,              // ^
+    Tilde,              // ~
+    Bang,               // !
+    Ampersand,          // &
+    Pipe,               // |
+    ShiftLeft,          // <<
+    ShiftRight,         // >>
+
+    // Comparison
+    Equal,              // =
+    EqualEqual,         // ==
+    NotEqual,           // != or <>
+    Less,               // <
+    LessEqual,          // <=
+    Greater,            // >
+    GreaterEqual,       // >=
+
+    // Logical and SQL-specific
+    Concat,             // ||
+    AndAnd,             // &&
+    Cast,               // ::
+    Colon,              // :
+    Dot,                // .
+    NamedArgument,      // =>
+
+    // PostgreSQL JSON, containment, pattern and text-search operators
+    Arrow,              // ->
+    ArrowText,          // ->>
+    HashArrow,          // #>
+    HashArrowText,      // #>>
+    Contains,           // @>
+    ContainedBy,        // <@
+    QuestionPipe,       // ?|
+    QuestionAmpersand,  // ?&
+    AtAt,               // @@
+    RegexMatchInsensitive,      // ~*
+    RegexNotMatch,              // !~
+    RegexNotMatchInsensitive,   // !~*
+    Question,           // ?
+    At,                 // @
+    Hash,               // #
+
+    // Delimiters (TokenType::Delimiter)
+    LeftParen,          // (
+    RightParen,         // )
+    LeftBracket,        // [
+    RightBracket,       // ]
+    LeftBrace,          // {
+    RightBrace,         // }
+    Comma,              // ,
+    Semicolon,          // ;
+
+    Other               // Any other single character
+};
+
+inline constexpr size_t OPERATOR_KIND_COUNT = static_cast<size_t>(OperatorKind::Other) + 1;
+
+[[nodiscard]] constexpr bool is_delimiter_kind(OperatorKind kind) noexcept {
+    return kind >= OperatorKind::LeftParen && kind <= OperatorKind::Semicolon;
+}
+
+struct OperatorMatch {
+    OperatorKind kind;
+    uint8_t length;     // 1-3 bytes
+};
+
+namespace operator_detail {
+
+struct Spelling {
+    std::string_view text;
+    OperatorKind kind;
+};
+
+inline constexpr Spelling SPELLINGS[] = {
+    {"+", OperatorKind::Plus}, {"-", OperatorKind::Minus}, {"*", OperatorKind::Star},
+    {"/", OperatorKind::Slash}, {"%", OperatorKind::Percent}, {"^", OperatorKind::Caret},
+    {"~", OperatorKind::Tilde}, {"!", OperatorKind::Bang}, {"&", OperatorKind::Ampersand},
+    {"|", OperatorKind::Pipe}, {"<<", OperatorKind::ShiftLeft}, {">>", OperatorKind::ShiftRight},
+    {"=", OperatorKind::Equal}, {"==", OperatorKind::EqualEqual}, {"!=", OperatorKind::NotEqual},
+    {"<>", OperatorKind::NotEqual}, {"<", OperatorKind::Less}, {"<=", OperatorKind::LessEqual},
+    {">", OperatorKind::Greater}, {">=", OperatorKind::GreaterEqual}, {"||", OperatorKind::Concat},
+    {"&&", OperatorKind::AndAnd}, {"::", OperatorKind::Cast}, {":", OperatorKind::Colon},
+    {".", OperatorKind::Dot}, {"=>", OperatorKind::NamedArgument},
+    {"->", OperatorKind::Arrow}, {"->>", OperatorKind::ArrowText},
+    {"#>", OperatorKind::HashArrow}, {"#>>", OperatorKind::HashArrowText},
+    {"@>", OperatorKind::Contains}, {"<@", OperatorKind::ContainedBy},
+    {"?|", OperatorKind::QuestionPipe}, {"?&", OperatorKind::QuestionAmpersand},
+    {"@@", OperatorKind::AtAt}, {"~*", OperatorKind::RegexMatchInsensitive},
+    {"!~", OperatorKind::RegexNotMatch}, {"!~*", OperatorKind::RegexNotMatchInsensitive},
+    {"?", OperatorKind::Question}, {"@", OperatorKind::At}, {"#", OperatorKind::Hash},
+    {"(", OperatorKind::LeftParen}, {")", OperatorKind::RightParen},
+    {"[", OperatorKind::LeftBracket}, {"]", OperatorKind::RightBracket},
+    {"{", OperatorKind::LeftBrace}, {"}", OperatorKind::RightBrace},
+    {",", OperatorKind::Comma}, {";", OperatorKind::Semicolon},
+};
+
+// Characters that can start or continue a multi-character operator get a
+// small index so the pair table stays 32 x 32; all other bytes map to 0
+inline constexpr std::string_view PAIR_CHARS = "-<>=!|&:#@?~*";
+inline constexpr size_t PAIR_INDEX_COUNT = 32;
+static_assert(PAIR_CHARS.size() < PAIR_INDEX_COUNT);
+
+inline constexpr auto PAIR_INDEX = [] {
+    std::array<uint8_t, 256> table{};
+    for (size_t i = 0; i < PAIR_CHARS.size(); ++i) {
+        table[static_cast<uint8_t>(PAIR_CHARS[i])] = static_cast<uint8_t>(i + 1);
+    }
+    return table;
+}();
+
+inline constexpr auto SINGLE = [] {
+    std::array<OperatorKind, 256> table{};
+    for (auto& kind : table) kind = OperatorKind::Other;
+    for (const auto& spelling : SPELLINGS) {
+        if (spelling.text.size() == 1) {
+            table[static_cast<uint8_t>(spelling.text[0])] = spelling.kind;
+        }
+    }
+    return table;
+}();
+
+inline constexpr auto PAIRS = [] {
+    std::array<OperatorKind, PAIR_INDEX_COUNT * PAIR_INDEX_COUNT> table{};
+    for (const auto& spelling : SPELLINGS) {
+        if (spelling.text.size() == 2) {
+            table[PAIR_INDEX[static_cast<uint8_t>(spelling.text[0])] * PAIR_INDEX_COUNT +
+                  PAIR_INDEX[static_cast<uint8_t>(spelling.text[1])]] = spelling.kind;
+        }
+    }
+    return table;
+}();
+
+// Three-character forms extend a two-character kind by one byte
+struct Extension {
+    uint8_t next;
+    OperatorKind kind;
+};
+
+inline constexpr auto EXTENSIONS = [] {
+    std::array<Extension, OPERATOR_KIND_COUNT> table{};
+    for (const auto& spelling : SPELLINGS) {
+        if (spelling.text.size() == 3) {
+            OperatorKind prefix = PAIRS[PAIR_INDEX[static_cast<uint8_t>(spelling.text[0])] * PAIR_INDEX_COUNT +
+                                        PAIR_INDEX[static_cast<uint8_t>(spelling.text[1])]];
+            table[static_cast<size_t>(prefix)] = {static_cast<uint8_t>(spelling.text[2]), spelling.kind};
+        }
+    }
+    return table;
+}();
+
+}  // namespace operator_detail
+
+// Longest operator or delimiter at `p` (size >= 1). Bytes that are not a
+// known operator form a one-byte OperatorKind::Other.
+[[nodiscard]] constexpr OperatorMatch match_operator(const uint8_t* p, size_t size) noexcept {
+    using namespace operator_detail;
+    uint8_t second = size > 1 ? p[1] : 0;
+    OperatorKind pair = PAIRS[PAIR_INDEX[p[0]] * PAIR_INDEX_COUNT + PAIR_INDEX[second]];
+    if (pair == OperatorKind::None) {
+        return {SINGLE[p[0]], 1};
+    }
+    const Extension& extension = EXTENSIONS[static_cast<size_t>(pair)];
+    if (extension.kind != OperatorKind::None && size > 2 && p[2] == extension.next) {
+        return {extension.kind, 3};
+    }
+    return {pair, 2};
+}
+
+// Kind of a complete operator token's text; None if `text` would not lex
+// as exactly one operator or delimiter
+[[nodiscard]] constexpr OperatorKind operator_kind(std::string_view text) noexcept {
+    if (text.empty() || text.size() > 3) {
+        return OperatorKind::None;
+    }
+    uint8_t bytes[3] = {};
+    for (size_t i = 0; i < text.size(); ++i) {
+        bytes[i] = static_cast<uint8_t>(text[i]);
+    }
+    OperatorMatch match = match_operator(bytes, text.size());
+    return match.length == text.size() ? match.kind : OperatorKind::None;
+}
+
+}  // namespace db25
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// psql scripts
+// ============
+// pg_dump plain-format output is a psql script rather than plain SQL:
+// table data follows "COPY ... FROM stdin;" as raw tab-separated lines
+// ending with a "\." line, and backslash meta-commands (\connect,
+// \restrict, \set, ...) sit between statements. With set_psql_script(true)
+// SimdTokenizer and StatementSplitter read these the way psql does:
+//
+//   - A '\' outside literals and comments starts a meta-command that runs
+//     to the end of its line (MetaCommand token).
+//   - When the ';' of COPY ... FROM stdin is followed only by blanks up to
+//     the end of its line, the lines after it, up to the "\." line, are
+//     one raw CopyData span. The "\." line is a meta-command.
+//
+// The "\." line is found a 64-byte block at a time from '\n' and '\'
+// masks; a '\' only counts right after a newline, so data bytes are never
+// visited individually.
+
+#include <cstddef>
+#include <string_view>
+
+namespace db25 {
+
+struct CopyDataMatch {
+    size_t end = 0;         // The '\' of the "\." line, or the input size if there is none
+    size_t newlines = 0;    // '\n' bytes in the data
+};
+
+// True if `statement` is COPY ... FROM STDIN (case-insensitive; comments
+// and literals are skipped)
+[[nodiscard]] bool is_copy_from_stdin(std::string_view statement) noexcept;
+
+// Start of the data after the ';' at `semicolon`: the byte after the end
+// of its line, or SIZE_MAX if anything but blanks follows the ';'
+[[nodiscard]] size_t copy_data_begin(const std::byte* input, size_t size, size_t semicolon) noexcept;
+
+// Scans data lines starting at the line start `begin`
+[[nodiscard]] CopyDataMatch find_copy_data_end(const std::byte* input, size_t size, size_t begin);
+
+// One past the meta-command starting at `start`, before its "\n" or "\r\n"
+[[nodiscard]] size_t meta_command_end(const std::byte* input, size_t size, size_t start) noexcept;
+
+}  // namespace db25
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// 64-byte block classification
+// ============================
+// match_block() compares one 64-byte block against a small set of byte
+// values and returns one 64-bit mask per value (bit i set = byte i
+// matches). Scanners built on top iterate set bits with countr_zero
+// instead of visiting every byte. Overloads exist per SIMD processor;
+// the generic template is the scalar fallback.
+
+#include "simd_architecture.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace db25 {
+
+inline constexpr size_t SCAN_BLOCK_SIZE = 64;
+
+template<typename Processor, size_t N>
+[[nodiscard]] inline std::array<uint64_t, N> match_block(Processor, const uint8_t* block,
+                                                         const std::array<uint8_t, N>& chars) noexcept {
+    std::array<uint64_t, N> masks{};
+    for (size_t i = 0; i < SCAN_BLOCK_SIZE; ++i) {
+        for (size_t c = 0; c < N; ++c) {
+            masks[c] |= uint64_t(block[i] == chars[c]) << i;
+        }
+    }
+    return masks;
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#if defined(__SSE4_2__)
+template<size_t N>
+[[nodiscard]] inline std::array<uint64_t, N> match_block(SSE42Processor, const uint8_t* block,
+                                                         const std::array<uint8_t, N>& chars) noexcept {
+    __m128i v[4];
+    for (size_t k = 0; k < 4; ++k) {
+        v[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * k));
+    }
+    std::array<uint64_t, N> masks{};
+    for (size_t c = 0; c < N; ++c) {
+        const __m128i needle = _mm_set1_epi8(static_cast<char>(chars[c]));
+        for (size_t k = 0; k < 4; ++k) {
+            uint64_t bits = static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v[k], needle)));
+            masks[c] |= bits << (16 * k);
+        }
+    }
+    return masks;
+}
+#endif
+
+#if defined(__AVX2__)
+template<size_t N>
+[[nodiscard]] inline std::array<uint64_t, N> match_block(AVX2Processor, const uint8_t* block,
+                                                         const std::array<uint8_t, N>& chars) noexcept {
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+    std::array<uint64_t, N> masks{};
+    for (size_t c = 0; c < N; ++c) {
+        const __m256i needle = _mm256_set1_epi8(static_cast<char>(chars[c]));
+        uint64_t low = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lo, needle)));
+        uint64_t high = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(hi, needle)));
+        masks[c] = low | (high << 32);
+    }
+    return masks;
+}
+#endif
+
+#if defined(__AVX512BW__)
+template<size_t N>
+[[nodiscard]] inline std::array<uint64_t, N> match_block(AVX512Processor, const uint8_t* block,
+                                                         const std::array<uint8_t, N>& chars) noexcept {
+    const __m512i v = _mm512_loadu_si512(block);
+    std::array<uint64_t, N> masks{};
+    for (size_t c = 0; c < N; ++c) {
+        masks[c] = _mm512_cmpeq_epi8_mask(v, _mm512_set1_epi8(static_cast<char>(chars[c])));
+    }
+    return masks;
+}
+#endif
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+// Collapses four 16-byte comparison results into one 64-bit mask
+[[nodiscard]] inline uint64_t neon_movemask64(uint8x16_t a, uint8x16_t b,
+                                              uint8x16_t c, uint8x16_t d) noexcept {
+    const uint8x16_t bits = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t sum0 = vpaddq_u8(vandq_u8(a, bits), vandq_u8(b, bits));
+    uint8x16_t sum1 = vpaddq_u8(vandq_u8(c, bits), vandq_u8(d, bits));
+    sum0 = vpaddq_u8(sum0, sum1);
+    sum0 = vpaddq_u8(sum0, sum0);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+}
+
+template<size_t N>
+[[nodiscard]] inline std::array<uint64_t, N> match_block(NeonProcessor, const uint8_t* block,
+                                                         const std::array<uint8_t, N>& chars) noexcept {
+    const uint8x16_t v0 = vld1q_u8(block);
+    const uint8x16_t v1 = vld1q_u8(block + 16);
+    const uint8x16_t v2 = vld1q_u8(block + 32);
+    const uint8x16_t v3 = vld1q_u8(block + 48);
+    std::array<uint64_t, N> masks{};
+    for (size_t c = 0; c < N; ++c) {
+        const uint8x16_t needle = vdupq_n_u8(chars[c]);
+        masks[c] = neon_movemask64(vceqq_u8(v0, needle), vceqq_u8(v1, needle),
+                                   vceqq_u8(v2, needle), vceqq_u8(v3, needle));
+    }
+    return masks;
+}
+
+#endif
+
+// Loads the block at `offset`, zero-padding past `size` so the tail can be
+// classified with the same kernel. Returns a pointer valid for 64 bytes.
+[[nodiscard]] inline const uint8_t* load_scan_block(const uint8_t* data, size_t size, size_t offset,
+                                                    uint8_t (&scratch)[SCAN_BLOCK_SIZE]) noexcept {
+    if (size - offset >= SCAN_BLOCK_SIZE) {
+        return data + offset;
+    }
+    std::memset(scratch, 0, SCAN_BLOCK_SIZE);
+    std::memcpy(scratch, data + offset, size - offset);
+    return scratch;
+}
+
+}  // namespace db25
@@ -23,11 +23,17 @@
 
 #include "simd_architecture.hpp"
 #include "keywords.hpp"
+#include "numeric_literal.hpp"
+#include "operator_kind.hpp"
+#include "bracket_index.hpp"
+#include "literal_rows.hpp"
 #include <string_view>
 #include <vector>
 
 namespace db25 {
 
+class SymbolTable;
+
 enum class TokenType : uint8_t {
     Unknown,
     Keyword,
@@ -38,34 +44,78 @@ enum class TokenType : uint8_t {
     Delimiter,
     Whitespace,
     Comment,
-    EndOfFile
+    EndOfFile,
+    LiteralList,    // Run of literal tuples; see set_literal_rows()
+    CopyData,       // Raw COPY ... FROM stdin data; see set_psql_script()
+    MetaCommand,    // psql backslash command line; see set_psql_script()
+    DollarString    // $$ ... $$ / $tag$ ... $tag$; see set_dollar_quotes()
 };
 
 // Packed token structure - optimized from 48 bytes to 32 bytes (33% reduction)
 struct Token {
     // Small fields grouped together to minimize padding
     TokenType type;              // 1 byte @ offset 0
-    uint8_t reserved;            // 1 byte @ offset 1 (for future use)
+    uint8_t reserved;            // 1 byte @ offset 1 (OperatorKind of Operator/Delimiter tokens)
     Keyword keyword_id;          // 2 bytes @ offset 2-3
     uint32_t line;               // 4 bytes @ offset 4-7 (max 4 billion lines)
     uint32_t column;             // 4 bytes @ offset 8-11 (max 4 billion columns)
-    // 4 bytes padding @ offset 12-15 (automatic alignment for string_view)
+    uint32_t symbol_id;          // 4 bytes @ offset 12-15 (interned identifier, 0 = none;
+                                 //   LiteralList: LiteralRowIndex::lists index + 1)
     std::string_view value;      // 16 bytes @ offset 16-31 (8-byte aligned)
     
     // Constructor for easy initialization
     Token() : type(TokenType::Unknown), reserved(0), keyword_id(Keyword::UNKNOWN), 
-              line(0), column(0), value() {}
+              line(0), column(0), symbol_id(0), value() {}
     
     Token(TokenType t, std::string_view v, uint32_t l, uint32_t c, 
           Keyword k = Keyword::UNKNOWN)
-        : type(t), reserved(0), keyword_id(k), line(l), column(c), value(v) {}
+        : type(t), reserved(0), keyword_id(k), line(l), column(c), symbol_id(0), value(v) {}
+    
+    [[nodiscard]] OperatorKind operator_kind() const noexcept {
+        return static_cast<OperatorKind>(reserved);
+    }
+    
+    // KeywordAttr bits of keyword tokens (0 for all other tokens)
+    [[nodiscard]] uint16_t keyword_attributes() const noexcept {
+        return KEYWORD_ATTRIBUTES[static_cast<size_t>(keyword_id)];
+    }
 };
 
 // Verify token packing at compile time
 static_assert(sizeof(Token) == 32, "Token structure should be 32 bytes for optimal packing");
 static_assert(offsetof(Token, value) == 16, "string_view should be 8-byte aligned");
 
-class SimdTokenizer {
+// Keyword classification applied to identifier-shaped words
+enum class KeywordMode : uint8_t {
+    Full,       // Generated lookup, then the SIMD keyword matcher (default)
+    Lookup,     // Generated lookup only
+    None        // No lookup: every word is an Identifier
+};
+
+// How next_token() classifies the first byte and scans words
+enum class LexerKind : uint8_t {
+    HandWritten,    // If-chains plus keyword lookup (default)
+    Dfa             // Generated tables (lexer_dfa.hpp): identifier and keyword in one walk
+};
+
+// Compile-time tokenizer options. Work a caller does not need is compiled
+// out of the scanner instead of being filtered from its output.
+template<bool EmitComments = true, bool TrackPositions = true, KeywordMode Keywords = KeywordMode::Full,
+         LexerKind Lexer = LexerKind::HandWritten>
+struct TokenizerPolicy {
+    static constexpr bool emit_comments = EmitComments;      // false: comments are skipped like whitespace
+    static constexpr bool track_positions = TrackPositions;  // false: line and column are left at 0
+    static constexpr KeywordMode keywords = Keywords;        // With Dfa, Full and Lookup are equivalent
+    static constexpr LexerKind lexer = Lexer;
+};
+
+using DefaultTokenizerPolicy = TokenizerPolicy<>;
+using RouterTokenizerPolicy = TokenizerPolicy<false, false, KeywordMode::Lookup>;
+
+// Member definitions live in simd_tokenizer.cpp, which instantiates every
+// TokenizerPolicy combination.
+template<typename Policy = DefaultTokenizerPolicy>
+class BasicSimdTokenizer {
 private:
     SimdDispatcher dispatcher_;
     const std::byte* input_;
@@ -73,21 +123,100 @@ private:
     size_t position_;
     uint32_t line_;     // Changed from size_t to uint32_t for packing
     uint32_t column_;   // Changed from size_t to uint32_t for packing
+    uint64_t token_index_ = 0;                        // Tokens returned by next() so far
+    std::vector<NumericValue>* numeric_out_ = nullptr; // Optional numeric side channel
+    SymbolTable* symbols_ = nullptr;                   // Optional identifier interning
+    BracketIndex* brackets_ = nullptr;                 // Optional matching-bracket index
+    size_t utf8_checked_ = 0;                          // Input before this offset is UTF-8 validated
+    size_t utf8_error_;                                // First invalid UTF-8 byte (input size if none)
+    bool compound_keywords_ = false;                   // Fuse COMPOUND_KEYWORDS sequences
+    LiteralRowIndex* literal_rows_ = nullptr;          // Optional bulk VALUES / IN fast path
+    Keyword literal_rows_after_ = Keyword::UNKNOWN;    // VALUES, IN or NOT_IN if it was the last token
+    bool psql_script_ = false;                         // COPY data blocks and meta-commands
+    bool copy_data_pending_ = false;                   // Last token ended COPY ... FROM stdin
+    size_t statement_begin_ = 0;                       // After the last ';' or meta-command
+    bool dollar_quotes_ = false;                       // $tag$ ... $tag$ as one token
     
 public:
-    SimdTokenizer(const std::byte* input, size_t size);
+    using policy_type = Policy;
+    
+    BasicSimdTokenizer(const std::byte* input, size_t size);
     [[nodiscard]] std::vector<Token> tokenize();
+    
+    // Pull-style lexing: stores the next non-whitespace token in `out`.
+    // Returns false once the input is exhausted.
+    [[nodiscard]] bool next(Token& out);
+    
+    // Optional side channel: while set, every Number token also appends its
+    // parsed value to `values` (token_index = position in the token stream).
+    void set_numeric_output(std::vector<NumericValue>* values) noexcept { numeric_out_ = values; }
+    
+    // Optional interning: while set, Identifier tokens carry the symbol ID of
+    // their case-folded name. The table may be shared across tokenizers.
+    void set_symbol_table(SymbolTable* symbols) noexcept { symbols_ = symbols; }
+    
+    // Optional side channel: while set, every token is recorded in `index`
+    // (nesting depth, partner of each bracket, unbalanced brackets) under
+    // its position in the token stream.
+    void set_bracket_output(BracketIndex* index) noexcept { brackets_ = index; }
+    
+    // Optional stage: while enabled, a keyword sequence from COMPOUND_KEYWORDS
+    // (ORDER BY, LEFT OUTER JOIN, IS NOT NULL, ...) becomes one Keyword token
+    // with the compound's ID, spanning any whitespace and comments between
+    // the words. The longest sequence wins. No effect with KeywordMode::None.
+    void set_compound_keywords(bool enabled) noexcept { compound_keywords_ = enabled; }
+    
+    // Optional fast path: while set, the literal tuples after VALUES (or the
+    // list after IN / NOT IN) become one LiteralList token whose symbol_id
+    // is its `index.lists` index + 1, so 0 still means none; look it up with
+    // index.list(symbol_id). The fields are in `index`, not in the token
+    // stream. Lists that are not all literals are lexed normally. Numbers
+    // inside a list do not reach set_numeric_output(). No effect with
+    // KeywordMode::None.
+    void set_literal_rows(LiteralRowIndex* index) noexcept { literal_rows_ = index; }
+    
+    // Optional mode for psql scripts such as pg_dump output (psql_script.hpp):
+    // while enabled, a '\' outside literals starts a MetaCommand token that
+    // runs to the end of its line, and the data lines after
+    // COPY ... FROM stdin; become one CopyData token, followed by the "\."
+    // MetaCommand. Data bytes are never lexed.
+    void set_psql_script(bool enabled) noexcept { psql_script_ = enabled; }
+    
+    // Optional mode: while enabled, a PostgreSQL dollar quote ($$ ... $$ or
+    // $tag$ ... $tag$) is one DollarString token and its body is not lexed;
+    // DollarBodyTokenizer (dollar_quote.hpp) lexes it on demand.
+    void set_dollar_quotes(bool enabled) noexcept { dollar_quotes_ = enabled; }
+    
+    // Offset of the first invalid UTF-8 byte in the input lexed so far, or
+    // the input size if there is none. Invalid bytes become 1-byte Unknown tokens.
+    [[nodiscard]] size_t utf8_error_offset() const noexcept { return utf8_error_; }
+    
     [[nodiscard]] const char* simd_level() const noexcept;
     
 private:
     Token next_token();
     Token scan_identifier_or_keyword(size_t start, uint32_t start_line, uint32_t start_column);
+    Token scan_invalid_or_identifier(size_t start, uint32_t start_line, uint32_t start_column);
     Token scan_number(size_t start, uint32_t start_line, uint32_t start_column);
     Token scan_string(size_t start, uint32_t start_line, uint32_t start_column, uint8_t quote);
     Token scan_comment(size_t start, uint32_t start_line, uint32_t start_column);
     Token scan_block_comment(size_t start, uint32_t start_line, uint32_t start_column);
     Token scan_operator_or_delimiter(size_t start, uint32_t start_line, uint32_t start_column);
+    bool skip_comment();
+    [[nodiscard]] bool starts_conflict_action(size_t pos) const noexcept;
+    void fuse_compound_keyword(Token& token);
+    bool scan_literal_list(Token& token);
+    bool scan_copy_data(Token& token);
+    Token scan_meta_command();
+    bool scan_dollar_quote(Token& token);
     void update_position(size_t count);
+    void advance(size_t count) noexcept;
+    void advance_line() noexcept;
+    void validate_utf8_ahead();
+    size_t utf8_length_at(size_t pos) const noexcept;
 };
 
+using SimdTokenizer = BasicSimdTokenizer<DefaultTokenizerPolicy>;
+using RouterTokenizer = BasicSimdTokenizer<RouterTokenizerPolicy>;
+
 }  // namespace db25
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Early-exit statement classifier
+// ===============================
+// Routing needs only the statement kind and its first target table. The
+// classifier pulls tokens from a RouterTokenizer one at a time (comments
+// skipped, no positions) and stops as soon as both are known, so a huge
+// INSERT or SELECT is routed after its first few dozen bytes.
+//
+// Leading parentheses and WITH [RECURSIVE] common table expressions are
+// skipped; the kind is that of the main statement. A CTE body that starts
+// with INSERT / UPDATE / DELETE marks the statement as writing.
+//
+// A SELECT is lexed past its target only when the rest of the input holds
+// the word FOR, to find row-locking clauses (FOR UPDATE / NO KEY UPDATE /
+// SHARE / KEY SHARE) anywhere in the statement.
+//
+// Targets: the first name after FROM (SELECT, DELETE), INTO (INSERT),
+// UPDATE, or the object keyword of DDL (CREATE TABLE x, DROP INDEX y, ...).
+// Qualified names (a.b.c) and quoted identifiers are one span.
+
+#include "simd_tokenizer.hpp"
+#include <cstddef>
+#include <string_view>
+
+namespace db25 {
+
+enum class StatementKind : uint8_t {
+    Unknown,
+    Select,         // SELECT, VALUES
+    Insert,
+    Update,
+    Delete,
+    Ddl,            // CREATE, ALTER, DROP
+    Transaction,    // BEGIN, START, COMMIT, END, ROLLBACK, SAVEPOINT, RELEASE
+    Utility         // EXPLAIN, ANALYZE, VACUUM, REINDEX, PRAGMA, ATTACH, DETACH
+};
+
+[[nodiscard]] std::string_view statement_kind_name(StatementKind kind) noexcept;
+
+struct StatementClass {
+    StatementKind kind = StatementKind::Unknown;
+    Keyword keyword = Keyword::UNKNOWN;     // Keyword that decided the kind
+    Keyword object = Keyword::UNKNOWN;      // DDL object: TABLE, VIEW, INDEX, ...
+    std::string_view target;                // First target table (empty if none)
+    bool writes = false;                    // INSERT/UPDATE/DELETE/DDL, a writing CTE, SELECT ... INTO,
+                                            // or a row-locking SELECT ... FOR UPDATE/SHARE
+    size_t scanned = 0;                     // Bytes lexed before the classifier stopped
+
+    // A SELECT that neither writes nor locks rows: safe for a read replica
+    [[nodiscard]] bool read_only() const noexcept {
+        return kind == StatementKind::Select && !writes;
+    }
+};
+
+// Classifies the first statement of the input
+[[nodiscard]] StatementClass classify_statement(const std::byte* input, size_t size);
+
+[[nodiscard]] inline StatementClass classify_statement(std::string_view sql) {
+    return classify_statement(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+}
+
+}  // namespace db25
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// SIMD statement splitter
+// =======================
+// Finds top-level ';' boundaries without tokenizing. Each 64-byte block is
+// classified once into per-character bitmasks (quotes, '-', '/', '*', '\n',
+// ';'); a small quote/comment state machine then jumps between the set
+// bits relevant to its current state, so bytes inside literals and
+// comments are never visited individually.
+//
+// Boundaries match a token-level split on ';' Delimiter tokens produced by
+// SimdTokenizer, including '' / "" escapes and unterminated comments.
+// With set_psql_script(true) they match a tokenizer in the same mode: a
+// meta-command also ends its statement (boundary = its last byte), and a
+// COPY ... FROM stdin statement runs through its data block and "\."
+// line instead of ending at its ';'. With set_dollar_quotes(true) a
+// dollar-quoted body (dollar_quote.hpp) is skipped like any other literal.
+
+#include "simd_architecture.hpp"
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace db25 {
+
+// Byte range [begin, end) of one statement. Leading whitespace is skipped;
+// the terminating ';' (if any) is included.
+struct StatementSpan {
+    size_t begin;
+    size_t end;
+
+    [[nodiscard]] std::string_view text(std::string_view source) const noexcept {
+        return source.substr(begin, end - begin);
+    }
+};
+
+class StatementSplitter {
+private:
+    SimdDispatcher dispatcher_;
+    bool psql_script_ = false;
+    bool dollar_quotes_ = false;
+
+public:
+    // Offsets of every top-level ';'
+    [[nodiscard]] std::vector<size_t> find_boundaries(const std::byte* input, size_t size) const;
+
+    // Statements delimited by those boundaries; a trailing statement without
+    // ';' is included unless it is whitespace only
+    [[nodiscard]] std::vector<StatementSpan> split(const std::byte* input, size_t size) const;
+
+    [[nodiscard]] std::vector<StatementSpan> split(std::string_view sql) const {
+        return split(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    }
+
+    // Reads the input as a psql script (psql_script.hpp)
+    void set_psql_script(bool enabled) noexcept { psql_script_ = enabled; }
+
+    // Skips $tag$ ... $tag$ bodies (dollar_quote.hpp)
+    void set_dollar_quotes(bool enabled) noexcept { dollar_quotes_ = enabled; }
+
+    [[nodiscard]] const char* simd_level() const noexcept { return dispatcher_.level_name(); }
+};
+
+[[nodiscard]] inline std::vector<StatementSpan> split_statements(std::string_view sql) {
+    return StatementSplitter{}.split(sql);
+}
+
+}  // namespace db25
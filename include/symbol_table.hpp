@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Identifier interning
+// ====================
+// Maps unquoted identifiers, compared ASCII case-insensitively as SQL does,
+// to dense uint32_t symbol IDs. The table is sharded by hash and safe to
+// share between tokenizers running on different threads: lookups of known
+// names take a shared lock on one shard, new names an exclusive one plus a
+// short table-wide lock that assigns the ID once the name is stored.
+// IDs start at 1; NO_SYMBOL (0) marks tokens that were not interned.
+
+#include "optimization_hints.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string_view>
+#include <vector>
+
+namespace db25 {
+
+inline constexpr uint32_t NO_SYMBOL = 0;
+
+// Case-insensitive hash of an identifier, eight bytes per step. Setting
+// bit 5 of every byte folds ASCII letters; digits and '_' are unaffected.
+[[nodiscard]] inline uint64_t symbol_hash(std::string_view name) noexcept {
+    constexpr uint64_t FOLD = 0x2020202020202020ULL;
+    constexpr uint64_t MULTIPLIER = 0xBF58476D1CE4E5B9ULL;
+
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ name.size();
+    const char* p = name.data();
+    size_t n = name.size();
+    while (n >= 8) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        hash = (hash ^ (word | FOLD)) * MULTIPLIER;
+        hash ^= hash >> 31;
+        p += 8;
+        n -= 8;
+    }
+    if (n > 0) {
+        uint64_t word = 0;
+        std::memcpy(&word, p, n);
+        hash = (hash ^ (word | (FOLD >> (8 * (8 - n))))) * MULTIPLIER;
+        hash ^= hash >> 31;
+    }
+    hash ^= hash >> 29;
+    hash *= 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 32);
+}
+
+[[nodiscard]] inline bool symbol_equals(std::string_view a, std::string_view b) noexcept {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        uint8_t x = static_cast<uint8_t>(a[i]);
+        uint8_t y = static_cast<uint8_t>(b[i]);
+        if (x != y) {
+            if ((x | 0x20) != (y | 0x20) || (x | 0x20) < 'a' || (x | 0x20) > 'z') {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+class SymbolTable {
+public:
+    static constexpr size_t SHARD_BITS = 6;
+    static constexpr size_t SHARD_COUNT = size_t(1) << SHARD_BITS;
+
+    SymbolTable();
+    ~SymbolTable();
+
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    // ID of `name`, assigning the next dense ID on first sight
+    [[nodiscard]] uint32_t intern(std::string_view name) {
+        return intern(name, symbol_hash(name));
+    }
+    // Same with a precomputed symbol_hash(name)
+    [[nodiscard]] uint32_t intern(std::string_view name, uint64_t hash);
+
+    // ID of `name` or NO_SYMBOL; never inserts
+    [[nodiscard]] uint32_t find(std::string_view name) const;
+
+    // Spelling `id` was first interned with
+    [[nodiscard]] std::string_view name(uint32_t id) const noexcept;
+
+    // Number of distinct symbols (IDs are 1..size())
+    [[nodiscard]] size_t size() const noexcept {
+        return next_id_.load(std::memory_order_acquire) - 1;
+    }
+
+private:
+    struct Entry {
+        uint64_t hash;
+        const char* text;
+        uint32_t length;
+        uint32_t id;       // NO_SYMBOL = empty slot
+    };
+
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        std::vector<Entry> slots;                    // Open addressing, power-of-two size
+        size_t count = 0;
+        std::vector<std::unique_ptr<char[]>> chunks; // Name storage, never moves
+        size_t chunk_used = 0;
+        size_t chunk_size = 0;
+
+        [[nodiscard]] const Entry* lookup(std::string_view name, uint64_t hash) const noexcept;
+        const char* store(std::string_view name);
+        void grow();
+    };
+
+    // id -> name; segment k holds IDs [2^k, 2^(k+1))
+    static constexpr size_t SEGMENT_COUNT = 32;
+
+    std::array<Shard, SHARD_COUNT> shards_;
+    std::array<std::atomic<std::string_view*>, SEGMENT_COUNT> names_{};
+    std::mutex publish_mutex_;            // Serializes ID assignment
+    std::atomic<uint32_t> next_id_{1};    // Released after names_[id] is written
+
+    [[nodiscard]] static size_t shard_index(uint64_t hash) noexcept {
+        return hash >> (64 - SHARD_BITS);
+    }
+    // Stores `name` under the next ID and makes both visible; returns the ID
+    uint32_t publish_name(std::string_view name);
+};
+
+}  // namespace db25
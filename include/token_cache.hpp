@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// On-disk token cache
+// ===================
+// Versioned binary format for tokenized dumps. The file is a 64-byte header
+// followed by fixed-size TokenRecords that hold offsets/lengths relative to
+// the source instead of pointers, so a later job can mmap the cache and use
+// it directly without lexing. The header carries a checksum of the source;
+// a stale cache is detected and the caller falls back to SimdTokenizer.
+//
+// Layout (native endianness, checked via endian_tag):
+//   TokenCacheHeader   64 bytes
+//   TokenRecord[n]     24 bytes each, 8-byte aligned
+//
+// Symbol IDs are not stored; they only mean something to the SymbolTable
+// that assigned them.
+
+#include "simd_tokenizer.hpp"
+#include "mapped_file.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace db25 {
+
+inline constexpr char TOKEN_CACHE_MAGIC[8] = {'D', 'B', '2', '5', 'T', 'O', 'K', '\0'};
+inline constexpr uint32_t TOKEN_CACHE_VERSION = 2;   // 2: flags carry OperatorKind
+inline constexpr uint32_t TOKEN_CACHE_ENDIAN_TAG = 0x01020304;
+
+struct TokenCacheHeader {
+    char magic[8];               // "DB25TOK\0"
+    uint32_t version;            // TOKEN_CACHE_VERSION
+    uint32_t endian_tag;         // TOKEN_CACHE_ENDIAN_TAG as written by the producer
+    uint32_t header_size;        // sizeof(TokenCacheHeader)
+    uint32_t record_size;        // sizeof(TokenRecord)
+    uint64_t token_count;
+    uint64_t source_size;
+    uint64_t source_checksum;    // source_checksum() of the tokenized bytes
+    uint8_t reserved[16];
+};
+
+struct TokenRecord {
+    uint64_t offset;             // Byte offset of the token in the source
+    uint32_t length;
+    uint32_t line;
+    uint32_t column;
+    TokenType type;
+    uint8_t flags;               // Token::reserved
+    Keyword keyword_id;
+};
+
+static_assert(sizeof(TokenCacheHeader) == 64, "Cache header should be one cache line");
+static_assert(sizeof(TokenRecord) == 24, "Token records should pack into 24 bytes");
+
+enum class CacheStatus : uint8_t {
+    Valid,
+    Missing,            // Cache file does not exist or cannot be read
+    Corrupt,            // Bad magic, truncated, inconsistent sizes or out-of-range records
+    VersionMismatch,    // Written by an incompatible format version
+    SourceChanged       // Source size or checksum differs from the cached one
+};
+
+[[nodiscard]] const char* cache_status_name(CacheStatus status) noexcept;
+
+// 64-bit checksum (XXH64, seed 0) of the source bytes
+[[nodiscard]] uint64_t source_checksum(const std::byte* data, size_t size) noexcept;
+
+// Writes `tokens` (views into `source`) as a cache file.
+// Throws std::system_error if the file cannot be written.
+void write_token_cache(const std::filesystem::path& path,
+                       const std::byte* source, size_t size,
+                       std::span<const Token> tokens);
+
+// Read-only, memory-mapped view of a cache file. Opening never throws;
+// status() reports whether the file is structurally usable.
+class TokenCache {
+private:
+    MappedFile file_;
+    const TokenCacheHeader* header_ = nullptr;
+    std::span<const TokenRecord> records_;
+    CacheStatus status_ = CacheStatus::Missing;
+
+public:
+    explicit TokenCache(const std::filesystem::path& path) noexcept;
+
+    [[nodiscard]] CacheStatus status() const noexcept { return status_; }
+
+    // Checks the cache against the current source (size + checksum)
+    [[nodiscard]] CacheStatus validate(const std::byte* source, size_t size) const noexcept;
+
+    [[nodiscard]] std::span<const TokenRecord> records() const noexcept { return records_; }
+    [[nodiscard]] const TokenCacheHeader* header() const noexcept { return header_; }
+
+    // Rebuilds tokens with views into `source` (which must be the validated source)
+    [[nodiscard]] Token token(size_t index, const std::byte* source) const noexcept;
+    [[nodiscard]] std::vector<Token> materialize(const std::byte* source) const;
+};
+
+struct CachedTokens {
+    std::vector<Token> tokens;
+    CacheStatus status;         // Status of the cache before any refresh
+
+    [[nodiscard]] bool from_cache() const noexcept { return status == CacheStatus::Valid; }
+};
+
+// Uses the cache at `cache_path` when it matches `source`; otherwise
+// tokenizes with SimdTokenizer and (if `refresh`) rewrites the cache.
+[[nodiscard]] CachedTokens load_or_tokenize(const std::filesystem::path& cache_path,
+                                            const std::byte* source, size_t size,
+                                            bool refresh = true);
+
+}  // namespace db25
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Compressed token encoding
+// =========================
+// Archival format for token streams, typically 1.5-2.5 bytes per token
+// instead of 32. Tokens are grouped into blocks of CODEC_BLOCK_TOKENS with
+// an index entry per block, so any block decodes independently.
+//
+// Per token:
+//   header    1 byte: TokenType in the low nibble, start delta from the
+//             previous token in the high nibble (15 = varint follows)
+//   keyword   1 byte index into the block's keyword dictionary (Keyword only;
+//             0xFF escapes to a raw 16-bit id)
+//   length    varint, only for String / Comment / compound keywords / other
+//             non-implicit types. Keywords, identifiers, numbers, operators
+//             and delimiters end where the whitespace before the next token
+//             starts.
+//   flags     1 byte Token::reserved, only in blocks where any differs from
+//             the OperatorKind the decoder derives from the source
+//
+// Line and column are not stored per token; the decoder recomputes them
+// from the source, finding newlines with 64-byte SIMD masks. That scan is
+// the only vectorized part: token headers are variable-length and parsed
+// one at a time. Decoding needs the exact source the tokens were produced
+// from. Symbol IDs are not encoded.
+
+#include "simd_tokenizer.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace db25 {
+
+inline constexpr size_t CODEC_BLOCK_TOKENS = 1024;
+inline constexpr char TOKEN_CODEC_MAGIC[8] = {'D', 'B', '2', '5', 'T', 'K', 'Z', '\0'};
+inline constexpr uint32_t TOKEN_CODEC_VERSION = 2;
+
+struct CodecHeader {
+    char magic[8];               // "DB25TKZ\0"
+    uint32_t version;
+    uint32_t block_tokens;       // Tokens per block (last block may be short)
+    uint64_t token_count;
+    uint64_t block_count;
+};
+
+// Index entry; the block's token count follows from block_tokens
+struct CodecBlock {
+    uint64_t stream_offset;      // Offset of the block's bytes in the stream section
+    uint64_t source_begin;       // Start of the block's first token
+    uint64_t source_end;         // End of the block's last token
+    uint32_t line;               // Position of the first token
+    uint32_t column;
+};
+
+static_assert(sizeof(CodecHeader) == 32, "Codec header layout changed");
+static_assert(sizeof(CodecBlock) == 32, "Codec block index layout changed");
+
+// Encodes tokens produced by SimdTokenizer over `source` into a
+// self-contained buffer: CodecHeader, CodecBlock[block_count], stream.
+// Throws std::invalid_argument if a token does not lie in `source` or its
+// position/length cannot be reproduced from it.
+[[nodiscard]] std::vector<uint8_t> encode_tokens(const std::byte* source, size_t size,
+                                                 std::span<const Token> tokens);
+
+// Random-access decoder over an encoded buffer (e.g. a MappedFile).
+// Throws std::invalid_argument on a malformed buffer, including token
+// types this version does not know.
+class TokenDecoder {
+private:
+    SimdDispatcher dispatcher_;
+    const CodecHeader* header_;
+    std::span<const CodecBlock> blocks_;
+    std::span<const uint8_t> stream_;
+    const std::byte* source_;
+    size_t source_size_;
+
+public:
+    TokenDecoder(std::span<const uint8_t> encoded, const std::byte* source, size_t size);
+
+    [[nodiscard]] size_t token_count() const noexcept { return header_->token_count; }
+    [[nodiscard]] size_t block_count() const noexcept { return blocks_.size(); }
+    [[nodiscard]] size_t block_size(size_t block) const noexcept;
+
+    // Writes the tokens of `block` to `out` (room for block_size(block)) and
+    // returns how many were written
+    size_t decode_block(size_t block, Token* out) const;
+
+    [[nodiscard]] std::vector<Token> decode() const;
+    [[nodiscard]] Token at(size_t index) const;
+
+    // Instruction set of the newline scan
+    [[nodiscard]] const char* simd_level() const noexcept { return dispatcher_.level_name(); }
+};
+
+}  // namespace db25
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Coroutine token generator
+// =========================
+// Lazily yields tokens from a SimdTokenizer so async query processing can
+// interleave lexing with other awaitable work. Coroutine frames are carved
+// out of a caller-supplied FrameArena and never touch the heap.
+//
+// A generator is thread-affine when its arena is: one created from the
+// per-thread arena must be resumed and destroyed on the thread that created
+// it. Any other use calls std::terminate(), in release builds too.
+
+#include "simd_tokenizer.hpp"
+#include "optimization_hints.hpp"
+#include <coroutine>
+#include <cstdio>
+#include <cstring>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <new>
+#include <span>
+#include <thread>
+#include <utility>
+
+namespace db25 {
+
+// LIFO bump allocator for coroutine frames. The arena rewinds once every
+// frame allocated from it has been released. It is not synchronized; an
+// arena bound to a thread terminates the process when used from another.
+class FrameArena {
+private:
+    std::byte* buffer_;
+    size_t capacity_;
+    size_t used_ = 0;
+    size_t live_ = 0;
+    std::thread::id owner_{};   // Default id: not bound to a thread
+
+public:
+    explicit FrameArena(std::span<std::byte> storage) noexcept
+        : buffer_(storage.data()), capacity_(storage.size()) {}
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    // Restricts the arena to the calling thread
+    void bind_to_current_thread() noexcept { owner_ = std::this_thread::get_id(); }
+
+    [[nodiscard]] bool usable_from_current_thread() const noexcept {
+        return owner_ == std::thread::id{} || owner_ == std::this_thread::get_id();
+    }
+
+    // Terminates on a foreign thread: continuing would corrupt the owner's frames
+    void require_current_thread(const char* what) const noexcept {
+        if (!usable_from_current_thread()) UNLIKELY {
+            std::fprintf(stderr, "db25: %s on a foreign thread\n", what);
+            std::terminate();
+        }
+    }
+
+    [[nodiscard]] void* allocate(size_t size) noexcept {
+        require_current_thread("FrameArena used");
+        size_t offset = (used_ + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+        if (offset + size > capacity_) UNLIKELY {
+            return nullptr;
+        }
+        used_ = offset + size;
+        ++live_;
+        return buffer_ + offset;
+    }
+
+    void deallocate(void* ptr, size_t size) noexcept {
+        require_current_thread("FrameArena used");
+        if (static_cast<std::byte*>(ptr) + size == buffer_ + used_) {
+            used_ = static_cast<size_t>(static_cast<std::byte*>(ptr) - buffer_);
+        }
+        if (--live_ == 0) {
+            used_ = 0;
+        }
+    }
+
+    [[nodiscard]] size_t used() const noexcept { return used_; }
+    [[nodiscard]] size_t capacity() const noexcept { return capacity_; }
+};
+
+// FrameArena with its storage held inline (e.g. on the caller's stack)
+template<size_t N>
+class InlineFrameArena : public FrameArena {
+private:
+    alignas(std::max_align_t) std::byte storage_[N];
+
+public:
+    InlineFrameArena() noexcept : FrameArena(std::span<std::byte>(storage_, N)) {}
+};
+
+// Per-thread arena used by the generate_tokens() overload without an arena;
+// bound to the calling thread
+[[nodiscard]] FrameArena& thread_frame_arena() noexcept;
+
+class TokenGenerator {
+public:
+    struct promise_type {
+        const Token* current_ = nullptr;
+        std::exception_ptr exception_;
+        FrameArena* arena_;
+
+        template<typename... Args>
+        explicit promise_type(FrameArena& arena, Args&&...) noexcept : arena_(&arena) {}
+
+        // Frames are allocated from the FrameArena passed as the first
+        // coroutine argument; the arena pointer is stashed after the frame.
+        template<typename... Args>
+        static void* operator new(size_t size, FrameArena& arena, Args&&...) {
+            void* frame = arena.allocate(size + sizeof(FrameArena*));
+            if (frame == nullptr) {
+                throw std::bad_alloc();
+            }
+            FrameArena* owner = &arena;
+            std::memcpy(static_cast<std::byte*>(frame) + size, &owner, sizeof(owner));
+            return frame;
+        }
+
+        static void operator delete(void* frame, size_t size) noexcept {
+            FrameArena* owner;
+            std::memcpy(&owner, static_cast<std::byte*>(frame) + size, sizeof(owner));
+            owner->deallocate(frame, size + sizeof(FrameArena*));
+        }
+
+        TokenGenerator get_return_object() noexcept {
+            return TokenGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+
+        std::suspend_always yield_value(const Token& token) noexcept {
+            current_ = &token;
+            return {};
+        }
+
+        void return_void() const noexcept {}
+        void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+    };
+
+    class iterator {
+    private:
+        std::coroutine_handle<promise_type> handle_;
+
+    public:
+        using value_type = Token;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() noexcept = default;
+        explicit iterator(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+        const Token& operator*() const noexcept { return *handle_.promise().current_; }
+        const Token* operator->() const noexcept { return handle_.promise().current_; }
+
+        iterator& operator++() {
+            resume(handle_);
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        bool operator==(std::default_sentinel_t) const noexcept { return !handle_ || handle_.done(); }
+    };
+
+    TokenGenerator(TokenGenerator&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+    TokenGenerator& operator=(TokenGenerator&& other) noexcept {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    ~TokenGenerator() {
+        if (handle_) {
+            handle_.promise().arena_->require_current_thread("TokenGenerator destroyed");
+            handle_.destroy();
+        }
+    }
+
+    [[nodiscard]] iterator begin() {
+        resume(handle_);
+        return iterator(handle_);
+    }
+    [[nodiscard]] std::default_sentinel_t end() const noexcept { return {}; }
+
+    // Resumes lexing until the next token; returns false once exhausted
+    [[nodiscard]] bool next(Token& out) {
+        resume(handle_);
+        if (!handle_ || handle_.done()) {
+            return false;
+        }
+        out = *handle_.promise().current_;
+        return true;
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+
+    explicit TokenGenerator(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+    static void resume(std::coroutine_handle<promise_type> handle) {
+        if (!handle || handle.done()) {
+            return;
+        }
+        handle.promise().arena_->require_current_thread("TokenGenerator resumed");
+        handle.resume();
+        if (handle.promise().exception_) UNLIKELY {
+            std::rethrow_exception(std::exchange(handle.promise().exception_, {}));
+        }
+    }
+};
+
+// Yields every non-whitespace token of `tokenizer`, frame allocated from `arena`.
+// The tokenizer and arena must outlive the generator.
+[[nodiscard]] TokenGenerator generate_tokens(FrameArena& arena, SimdTokenizer& tokenizer);
+
+// Same as above using the calling thread's frame arena. The generator is
+// thread-affine: resume and destroy it only on the calling thread.
+[[nodiscard]] TokenGenerator generate_tokens(SimdTokenizer& tokenizer);
+
+}  // namespace db25
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Lexer -> parser token pipeline
+// ==============================
+// A producer thread runs SimdTokenizer and publishes tokens in cache-line
+// aligned blocks into a bounded single-producer/single-consumer ring. The
+// parser thread consumes complete blocks while lexing is still in progress,
+// so it never observes a partially built token vector.
+
+#include "simd_tokenizer.hpp"
+#include "optimization_hints.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+
+namespace db25 {
+
+inline constexpr size_t CACHE_LINE_SIZE = 64;
+
+// 16 tokens = 8 cache lines of payload; the block header rides on the next line
+struct alignas(CACHE_LINE_SIZE) TokenBlock {
+    static constexpr size_t CAPACITY = 16;
+
+    std::array<Token, CAPACITY> tokens;
+    uint32_t count = 0;
+    bool end_of_stream = false;
+};
+
+static_assert(sizeof(Token) * TokenBlock::CAPACITY % CACHE_LINE_SIZE == 0,
+              "Token payload of a block should fill whole cache lines");
+
+// Bounded lock-free SPSC ring of token blocks.
+// Backpressure: the producer waits while the ring is full, the consumer
+// waits while it is empty. Both sides spin briefly and then park on the
+// opposite index with std::atomic::wait, so no mutex is ever taken.
+class SpscTokenRing {
+private:
+    std::unique_ptr<TokenBlock[]> slots_;
+    size_t mask_;
+
+    // Producer-owned cache line
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> head_{0};
+    uint64_t cached_tail_ = 0;
+
+    // Consumer-owned cache line
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> tail_{0};
+    uint64_t cached_head_ = 0;
+
+public:
+    // Capacity is rounded up to a power of two (minimum 2 blocks)
+    explicit SpscTokenRing(size_t capacity_blocks);
+
+    SpscTokenRing(const SpscTokenRing&) = delete;
+    SpscTokenRing& operator=(const SpscTokenRing&) = delete;
+
+    [[nodiscard]] size_t capacity() const noexcept { return mask_ + 1; }
+
+    // Producer side: claim the next free slot (blocks while full), then publish it
+    [[nodiscard]] TokenBlock& acquire_write();
+    void publish();
+
+    // Consumer side: wait for the next published slot, then hand it back
+    [[nodiscard]] const TokenBlock& acquire_read();
+    void release();
+};
+
+// Runs a SimdTokenizer on a dedicated producer thread and exposes the
+// resulting token stream to exactly one consumer thread.
+class TokenPipeline {
+private:
+    SpscTokenRing ring_;
+    SimdTokenizer tokenizer_;
+    const TokenBlock* current_ = nullptr;
+    size_t cursor_ = 0;
+    bool finished_ = false;
+    std::jthread producer_;
+
+    void produce(std::stop_token stop);
+
+public:
+    TokenPipeline(const std::byte* input, size_t size, size_t ring_blocks = 64);
+    ~TokenPipeline();
+
+    TokenPipeline(const TokenPipeline&) = delete;
+    TokenPipeline& operator=(const TokenPipeline&) = delete;
+
+    // Next complete block of tokens; an empty span marks the end of the stream.
+    // The span stays valid until the following call.
+    [[nodiscard]] std::span<const Token> next_block();
+
+    // Token-at-a-time view over next_block()
+    [[nodiscard]] bool next(Token& out);
+
+    [[nodiscard]] const char* simd_level() const noexcept { return tokenizer_.simd_level(); }
+};
+
+}  // namespace db25
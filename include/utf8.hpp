@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// UTF-8 validation
+// ================
+// validate_utf8() returns the offset of the first byte that does not start
+// a well-formed UTF-8 sequence (overlongs, surrogates and code points above
+// U+10FFFF are rejected), or the input size when everything is valid.
+//
+// Every 64-byte block is first tested for being all ASCII with one OR and
+// movemask. Blocks with high bits set go through the Keiser-Lemire lookup
+// check: three pshufb table lookups on the nibbles of each byte and its
+// predecessor classify every two-byte window, and saturating subtracts
+// catch missing third/fourth continuation bytes. The exact error offset is
+// then recovered with the scalar decoder.
+
+#include "simd_architecture.hpp"
+#include "simd_block_scan.hpp"
+#include "optimization_hints.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace db25 {
+
+// Length (1-4) of the well-formed sequence at `p` with `n` bytes available, 0 if invalid
+[[nodiscard]] constexpr size_t utf8_sequence_length(const uint8_t* p, size_t n) noexcept {
+    const uint8_t lead = p[0];
+    if (lead < 0x80) {
+        return 1;
+    }
+    auto continuation = [](uint8_t b) { return (b & 0xC0) == 0x80; };
+    if (lead < 0xC2) {
+        return 0;   // Stray continuation or overlong C0/C1
+    }
+    if (lead < 0xE0) {
+        return n >= 2 && continuation(p[1]) ? 2 : 0;
+    }
+    if (lead < 0xF0) {
+        if (n < 3 || !continuation(p[1]) || !continuation(p[2])) return 0;
+        if (lead == 0xE0 && p[1] < 0xA0) return 0;   // Overlong
+        if (lead == 0xED && p[1] >= 0xA0) return 0;  // Surrogate
+        return 3;
+    }
+    if (lead < 0xF5) {
+        if (n < 4 || !continuation(p[1]) || !continuation(p[2]) || !continuation(p[3])) return 0;
+        if (lead == 0xF0 && p[1] < 0x90) return 0;   // Overlong
+        if (lead == 0xF4 && p[1] >= 0x90) return 0;  // Above U+10FFFF
+        return 4;
+    }
+    return 0;
+}
+
+// Sequence length implied by a lead byte of already validated input
+[[nodiscard]] constexpr size_t utf8_lead_length(uint8_t lead) noexcept {
+    return lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+}
+
+namespace utf8_detail {
+
+[[nodiscard]] inline size_t validate_scalar(const uint8_t* data, size_t size, size_t pos) noexcept {
+    while (pos < size) {
+        if (pos + 8 <= size) {
+            uint64_t word;
+            std::memcpy(&word, data + pos, sizeof(word));
+            if ((word & 0x8080808080808080ULL) == 0) {
+                pos += 8;
+                continue;
+            }
+        }
+        if (data[pos] < 0x80) {
+            ++pos;
+            continue;
+        }
+        size_t length = utf8_sequence_length(data + pos, size - pos);
+        if (length == 0) {
+            return pos;
+        }
+        pos += length;
+    }
+    return size;
+}
+
+// Exact error offset once a block check has failed somewhere at or after
+// `from`: back up to the lead byte of the sequence straddling `from`
+[[nodiscard]] inline size_t locate_error(const uint8_t* data, size_t size, size_t from) noexcept {
+    for (int i = 0; i < 3 && from > 0 && (data[from] & 0xC0) == 0x80; ++i) {
+        --from;
+    }
+    return validate_scalar(data, size, from);
+}
+
+// Keiser-Lemire error classes for a (previous byte, byte) window
+inline constexpr uint8_t TOO_SHORT = 1 << 0;       // Lead not followed by a continuation
+inline constexpr uint8_t TOO_LONG = 1 << 1;        // Continuation after ASCII
+inline constexpr uint8_t OVERLONG_3 = 1 << 2;      // E0 80..9F
+inline constexpr uint8_t TOO_LARGE = 1 << 3;       // F4 90.. and above
+inline constexpr uint8_t SURROGATE = 1 << 4;       // ED A0..BF
+inline constexpr uint8_t OVERLONG_2 = 1 << 5;      // C0/C1 leads
+inline constexpr uint8_t TOO_LARGE_1000 = 1 << 6;  // F5.. 80..8F
+inline constexpr uint8_t OVERLONG_4 = 1 << 6;      // F0 80..8F
+inline constexpr uint8_t TWO_CONTS = 1 << 7;       // Continuation after continuation
+inline constexpr uint8_t CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS;
+
+// Indexed by the high nibble of the previous byte
+alignas(16) inline constexpr uint8_t BYTE_1_HIGH[16] = {
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+    TOO_SHORT | OVERLONG_2,
+    TOO_SHORT,
+    TOO_SHORT | OVERLONG_3 | SURROGATE,
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+};
+
+// Indexed by the low nibble of the previous byte
+alignas(16) inline constexpr uint8_t BYTE_1_LOW[16] = {
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+    CARRY | OVERLONG_2,
+    CARRY,
+    CARRY,
+    CARRY | TOO_LARGE,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000
+};
+
+// Indexed by the high nibble of the current byte
+alignas(16) inline constexpr uint8_t BYTE_2_HIGH[16] = {
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+};
+
+// Upper bound of each byte in the last three positions of a block that
+// does not end inside a sequence
+alignas(16) inline constexpr uint8_t INCOMPLETE_LIMIT[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+
+// Runs a block checker over the input; Checker::check_block() consumes
+// 64 bytes and Checker::finish() flags a sequence cut off by the end
+template<typename Checker>
+[[nodiscard]] inline size_t validate_blocks(const uint8_t* data, size_t size) noexcept {
+    Checker checker;
+    uint8_t scratch[SCAN_BLOCK_SIZE];
+    size_t block = 0;
+    for (; block < size; block += SCAN_BLOCK_SIZE) {
+        checker.check_block(load_scan_block(data, size, block, scratch));
+        if (checker.has_error()) UNLIKELY {
+            // An incomplete sequence is reported one block late
+            return locate_error(data, size, block >= SCAN_BLOCK_SIZE ? block - SCAN_BLOCK_SIZE : 0);
+        }
+    }
+    checker.finish();
+    if (checker.has_error()) UNLIKELY {
+        return locate_error(data, size, block >= SCAN_BLOCK_SIZE ? block - SCAN_BLOCK_SIZE : 0);
+    }
+    return size;
+}
+
+}  // namespace utf8_detail
+
+// Scalar: eight-byte ASCII words are skipped, anything else is decoded
+template<typename Processor>
+[[nodiscard]] inline size_t validate_utf8(Processor, const uint8_t* data, size_t size) noexcept {
+    return utf8_detail::validate_scalar(data, size, 0);
+}
+
+#if defined(__x86_64__) || defined(_M_X64)
+
+#if defined(__SSE4_2__)
+namespace utf8_detail {
+
+class Sse42Checker {
+private:
+    __m128i error_ = _mm_setzero_si128();
+    __m128i prev_input_ = _mm_setzero_si128();
+    __m128i prev_incomplete_ = _mm_setzero_si128();
+
+    static __m128i table(const uint8_t* t) noexcept {
+        return _mm_load_si128(reinterpret_cast<const __m128i*>(t));
+    }
+
+    static __m128i high_nibbles(__m128i v) noexcept {
+        return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+    }
+
+    void check_vector(__m128i input, __m128i prev_input) noexcept {
+        const __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+        const __m128i special = _mm_and_si128(
+            _mm_and_si128(_mm_shuffle_epi8(table(BYTE_1_HIGH), high_nibbles(prev1)),
+                          _mm_shuffle_epi8(table(BYTE_1_LOW), _mm_and_si128(prev1, _mm_set1_epi8(0x0F)))),
+            _mm_shuffle_epi8(table(BYTE_2_HIGH), high_nibbles(input)));
+
+        const __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+        const __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+        const __m128i must_be_continuation = _mm_or_si128(
+            _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+            _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+        const __m128i expected = _mm_and_si128(must_be_continuation, _mm_set1_epi8(static_cast<char>(0x80)));
+        error_ = _mm_or_si128(error_, _mm_xor_si128(expected, special));
+    }
+
+public:
+    void check_block(const uint8_t* block) noexcept {
+        __m128i v[4];
+        for (size_t k = 0; k < 4; ++k) {
+            v[k] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * k));
+        }
+        const __m128i any = _mm_or_si128(_mm_or_si128(v[0], v[1]), _mm_or_si128(v[2], v[3]));
+        if (_mm_movemask_epi8(any) == 0) LIKELY {
+            error_ = _mm_or_si128(error_, prev_incomplete_);
+        } else {
+            check_vector(v[0], prev_input_);
+            check_vector(v[1], v[0]);
+            check_vector(v[2], v[1]);
+            check_vector(v[3], v[2]);
+        }
+        prev_incomplete_ = _mm_subs_epu8(v[3], _mm_loadu_si128(reinterpret_cast<const __m128i*>(INCOMPLETE_LIMIT + 16)));
+        prev_input_ = v[3];
+    }
+
+    void finish() noexcept { error_ = _mm_or_si128(error_, prev_incomplete_); }
+
+    [[nodiscard]] bool has_error() const noexcept { return !_mm_testz_si128(error_, error_); }
+};
+
+}  // namespace utf8_detail
+
+[[nodiscard]] inline size_t validate_utf8(SSE42Processor, const uint8_t* data, size_t size) noexcept {
+    return utf8_detail::validate_blocks<utf8_detail::Sse42Checker>(data, size);
+}
+#endif
+
+#if defined(__AVX2__)
+namespace utf8_detail {
+
+class Avx2Checker {
+private:
+    __m256i error_ = _mm256_setzero_si256();
+    __m256i prev_input_ = _mm256_setzero_si256();
+    __m256i prev_incomplete_ = _mm256_setzero_si256();
+
+    static __m256i table(const uint8_t* t) noexcept {
+        return _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(t)));
+    }
+
+    static __m256i high_nibbles(__m256i v) noexcept {
+        return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+    }
+
+    // Input shifted right by N bytes with the tail of the previous vector
+    // shifted in (alignr only works within 128-bit lanes)
+    template<int N>
+    static __m256i prev(__m256i input, __m256i prev_input) noexcept {
+        return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21), 16 - N);
+    }
+
+    void check_vector(__m256i input, __m256i prev_input) noexcept {
+        const __m256i prev1 = prev<1>(input, prev_input);
+        const __m256i special = _mm256_and_si256(
+            _mm256_and_si256(_mm256_shuffle_epi8(table(BYTE_1_HIGH), high_nibbles(prev1)),
+                             _mm256_shuffle_epi8(table(BYTE_1_LOW), _mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)))),
+            _mm256_shuffle_epi8(table(BYTE_2_HIGH), high_nibbles(input)));
+
+        const __m256i must_be_continuation = _mm256_or_si256(
+            _mm256_subs_epu8(prev<2>(input, prev_input), _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+            _mm256_subs_epu8(prev<3>(input, prev_input), _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+        const __m256i expected = _mm256_and_si256(must_be_continuation, _mm256_set1_epi8(static_cast<char>(0x80)));
+        error_ = _mm256_or_si256(error_, _mm256_xor_si256(expected, special));
+    }
+
+public:
+    void check_block(const uint8_t* block) noexcept {
+        const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+        const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 32));
+        if (_mm256_movemask_epi8(_mm256_or_si256(lo, hi)) == 0) LIKELY {
+            error_ = _mm256_or_si256(error_, prev_incomplete_);
+        } else {
+            check_vector(lo, prev_input_);
+            check_vector(hi, lo);
+        }
+        prev_incomplete_ = _mm256_subs_epu8(hi, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(INCOMPLETE_LIMIT)));
+        prev_input_ = hi;
+    }
+
+    void finish() noexcept { error_ = _mm256_or_si256(error_, prev_incomplete_); }
+
+    [[nodiscard]] bool has_error() const noexcept { return !_mm256_testz_si256(error_, error_); }
+};
+
+}  // namespace utf8_detail
+
+[[nodiscard]] inline size_t validate_utf8(AVX2Processor, const uint8_t* data, size_t size) noexcept {
+    return utf8_detail::validate_blocks<utf8_detail::Avx2Checker>(data, size);
+}
+
+// The 256-bit lookup kernel; table shuffles gain nothing from 512-bit lanes
+[[nodiscard]] inline size_t validate_utf8(AVX512Processor, const uint8_t* data, size_t size) noexcept {
+    return utf8_detail::validate_blocks<utf8_detail::Avx2Checker>(data, size);
+}
+#endif
+
+#endif
+
+[[nodiscard]] inline size_t validate_utf8(const std::byte* data, size_t size) noexcept {
+    return SimdDispatcher{}.dispatch([&](auto processor) {
+        return validate_utf8(processor, reinterpret_cast<const uint8_t*>(data), size);
+    });
+}
+
+}  // namespace db25
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "arrow_export.hpp"
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace db25 {
+
+namespace {
+
+constexpr size_t COLUMN_COUNT = 6;
+
+struct ColumnType {
+    const char* format;
+    const char* name;
+};
+
+constexpr std::array<ColumnType, COLUMN_COUNT> COLUMNS = {{
+    {"C", "type"},
+    {"S", "keyword_id"},
+    {"L", "offset"},
+    {"I", "length"},
+    {"I", "line"},
+    {"I", "statement"},
+}};
+
+// Schema children only point at string literals; one moved out by the
+// consumer owns nothing of its own
+void release_child_schema(ArrowSchema* schema) {
+    schema->release = nullptr;
+}
+
+struct SchemaHolder {
+    std::array<ArrowSchema, COLUMN_COUNT> children{};
+    std::array<ArrowSchema*, COLUMN_COUNT> pointers{};
+};
+
+void release_schema(ArrowSchema* schema) {
+    auto* holder = static_cast<SchemaHolder*>(schema->private_data);
+    for (ArrowSchema& child : holder->children) {
+        if (child.release != nullptr) {
+            child.release(&child);
+        }
+    }
+    delete holder;
+    schema->release = nullptr;
+}
+
+// Token columns while they are being filled
+struct Columns {
+    std::vector<uint8_t> type;
+    std::vector<uint16_t> keyword_id;
+    std::vector<uint64_t> offset;
+    std::vector<uint32_t> length;
+    std::vector<uint32_t> line;
+    std::vector<uint32_t> statement;
+
+    void reserve(size_t tokens) {
+        type.reserve(tokens);
+        keyword_id.reserve(tokens);
+        offset.reserve(tokens);
+        length.reserve(tokens);
+        line.reserve(tokens);
+        statement.reserve(tokens);
+    }
+};
+
+// One child array's values and buffer table. Each child owns its column,
+// so a consumer may move a child out and release the parent first.
+template<typename T>
+struct ColumnHolder {
+    std::vector<T> values;
+    std::array<const void*, 2> buffers{};   // Validity (absent), values
+};
+
+template<typename T>
+void release_column(ArrowArray* array) {
+    delete static_cast<ColumnHolder<T>*>(array->private_data);
+    array->release = nullptr;
+}
+
+template<typename T>
+void export_column(std::vector<T>&& values, ArrowArray& child) {
+    auto holder = std::make_unique<ColumnHolder<T>>();
+    holder->values = std::move(values);
+    holder->buffers = {nullptr, holder->values.data()};
+    child = ArrowArray{static_cast<int64_t>(holder->values.size()), 0, 0, 2, 0, holder->buffers.data(),
+                       nullptr, nullptr, release_column<T>, holder.get()};
+    holder.release();
+}
+
+// The struct array's child structs and the pointer tables referring to them
+struct ArrayHolder {
+    std::array<ArrowArray, COLUMN_COUNT> children{};
+    std::array<ArrowArray*, COLUMN_COUNT> pointers{};
+    std::array<const void*, 1> buffers{};   // Struct validity: absent
+
+    // Releases the children still in place; moved-out ones have release == nullptr
+    ~ArrayHolder() {
+        for (ArrowArray& child : children) {
+            if (child.release != nullptr) {
+                child.release(&child);
+            }
+        }
+    }
+};
+
+void release_array(ArrowArray* array) {
+    delete static_cast<ArrayHolder*>(array->private_data);
+    array->release = nullptr;
+}
+
+template<typename Policy>
+void fill_columns(const std::byte* input, size_t size, Columns& columns) {
+    BasicSimdTokenizer<Policy> tokenizer(input, size);
+    const auto* base = reinterpret_cast<const char*>(input);
+    uint32_t statement = 0;
+    Token token;
+    while (tokenizer.next(token)) {
+        columns.type.push_back(static_cast<uint8_t>(token.type));
+        columns.keyword_id.push_back(static_cast<uint16_t>(token.keyword_id));
+        columns.offset.push_back(static_cast<uint64_t>(token.value.data() - base));
+        columns.length.push_back(static_cast<uint32_t>(token.value.size()));
+        columns.line.push_back(token.line);
+        columns.statement.push_back(statement);
+        statement += token.operator_kind() == OperatorKind::Semicolon;
+    }
+}
+
+}  // namespace
+
+void export_token_schema(ArrowSchema* schema) {
+    auto holder = std::make_unique<SchemaHolder>();
+    for (size_t i = 0; i < COLUMN_COUNT; ++i) {
+        holder->children[i] = ArrowSchema{
+            COLUMNS[i].format, COLUMNS[i].name, nullptr, 0, 0, nullptr, nullptr, release_child_schema, nullptr};
+        holder->pointers[i] = &holder->children[i];
+    }
+    *schema = ArrowSchema{"+s", "", nullptr, 0, static_cast<int64_t>(COLUMN_COUNT),
+                          holder->pointers.data(), nullptr, release_schema, holder.get()};
+    holder.release();
+}
+
+size_t export_tokens_arrow(const std::byte* input, size_t size, ArrowArray* array, ArrowSchema* schema,
+                           const ArrowExportOptions& options) {
+    Columns columns;
+    columns.reserve(size / 8 + 16);
+    if (options.emit_comments) {
+        fill_columns<TokenizerPolicy<true>>(input, size, columns);
+    } else {
+        fill_columns<TokenizerPolicy<false>>(input, size, columns);
+    }
+    const size_t count = columns.type.size();
+
+    auto holder = std::make_unique<ArrayHolder>();
+    export_column(std::move(columns.type), holder->children[0]);
+    export_column(std::move(columns.keyword_id), holder->children[1]);
+    export_column(std::move(columns.offset), holder->children[2]);
+    export_column(std::move(columns.length), holder->children[3]);
+    export_column(std::move(columns.line), holder->children[4]);
+    export_column(std::move(columns.statement), holder->children[5]);
+    for (size_t i = 0; i < COLUMN_COUNT; ++i) {
+        holder->pointers[i] = &holder->children[i];
+    }
+
+    if (schema != nullptr) {
+        export_token_schema(schema);
+    }
+    *array = ArrowArray{static_cast<int64_t>(count), 0, 0, 1, static_cast<int64_t>(COLUMN_COUNT),
+                        holder->buffers.data(), holder->pointers.data(), nullptr, release_array, holder.get()};
+    holder.release();
+    return count;
+}
+
+}  // namespace db25
@@ -0,0 +1,711 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "bulk_ingest.hpp"
+#include "optimization_hints.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define DB25_HAVE_POSIX_IO 1
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+    #define DB25_HAVE_IO_URING 1
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+    #include <sys/uio.h>
+#endif
+
+namespace db25 {
+
+namespace {
+
+constexpr unsigned NO_SLOT = ~0u;
+
+// Hands out buffer slots to the I/O thread and takes them back from workers
+class SlotPool {
+private:
+    std::mutex mutex_;
+    std::condition_variable available_;
+    std::vector<unsigned> free_;
+
+public:
+    explicit SlotPool(unsigned count) {
+        for (unsigned i = count; i > 0; --i) {
+            free_.push_back(i - 1);
+        }
+    }
+
+    bool try_acquire(unsigned& slot) {
+        std::lock_guard lock(mutex_);
+        if (free_.empty()) return false;
+        slot = free_.back();
+        free_.pop_back();
+        return true;
+    }
+
+    unsigned acquire() {
+        std::unique_lock lock(mutex_);
+        available_.wait(lock, [this] { return !free_.empty(); });
+        unsigned slot = free_.back();
+        free_.pop_back();
+        return slot;
+    }
+
+    void wait_available() {
+        std::unique_lock lock(mutex_);
+        available_.wait(lock, [this] { return !free_.empty(); });
+    }
+
+    void release(unsigned slot) {
+        {
+            std::lock_guard lock(mutex_);
+            free_.push_back(slot);
+        }
+        available_.notify_one();
+    }
+};
+
+// Buffer storage shared by the I/O thread and the workers
+struct BufferPool {
+    size_t buffer_size;
+    unsigned count;
+    std::unique_ptr<std::byte, decltype(&std::free)> storage;
+    std::vector<std::vector<std::byte>> spill;   // Per-slot overflow for large files
+
+    BufferPool(unsigned n, size_t size)
+        : buffer_size((size + 4095) & ~size_t(4095))
+        , count(n)
+        , storage(static_cast<std::byte*>(std::aligned_alloc(4096, buffer_size * n)), &std::free)
+        , spill(n) {
+        if (!storage) {
+            throw std::bad_alloc();
+        }
+    }
+
+    [[nodiscard]] std::byte* buffer(unsigned slot) const noexcept {
+        return storage.get() + slot * buffer_size;
+    }
+
+    // Leaks the buffers: for when I/O into them can no longer be waited for
+    void abandon() noexcept {
+        storage.get_deleter() = [](void*) noexcept {};
+    }
+};
+
+struct Job {
+    size_t file;
+    unsigned slot;
+    size_t size;
+    int error;
+};
+
+class WorkerPool {
+private:
+    std::span<const std::filesystem::path> paths_;
+    const IngestCallback& callback_;
+    BufferPool& buffers_;
+    SlotPool& slots_;
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<Job> queue_;
+    bool closing_ = false;
+    std::vector<std::thread> threads_;
+
+    void run() {
+        for (;;) {
+            Job job;
+            {
+                std::unique_lock lock(mutex_);
+                ready_.wait(lock, [this] { return !queue_.empty() || closing_; });
+                if (queue_.empty()) return;
+                job = queue_.front();
+                queue_.pop_front();
+            }
+            process(job);
+        }
+    }
+
+    void process(const Job& job) {
+        const std::byte* data = nullptr;
+        if (job.slot != NO_SLOT) {
+            auto& spill = buffers_.spill[job.slot];
+            data = spill.empty() ? buffers_.buffer(job.slot) : spill.data();
+        }
+
+        std::vector<Token> tokens;
+        if (job.error == 0) {
+            SimdTokenizer tokenizer(data, job.size);
+            tokens = tokenizer.tokenize();
+            files.fetch_add(1, std::memory_order_relaxed);
+            bytes.fetch_add(job.size, std::memory_order_relaxed);
+            token_count.fetch_add(tokens.size(), std::memory_order_relaxed);
+        } else {
+            failed.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        callback_(IngestedFile{
+            paths_[job.file],
+            std::string_view(reinterpret_cast<const char*>(data), job.size),
+            tokens,
+            job.error
+        });
+
+        if (job.slot != NO_SLOT) {
+            std::vector<std::byte>().swap(buffers_.spill[job.slot]);
+            slots_.release(job.slot);
+        }
+    }
+
+public:
+    std::atomic<size_t> files{0};
+    std::atomic<size_t> failed{0};
+    std::atomic<size_t> bytes{0};
+    std::atomic<size_t> token_count{0};
+
+    WorkerPool(unsigned count, std::span<const std::filesystem::path> paths,
+               const IngestCallback& callback, BufferPool& buffers, SlotPool& slots)
+        : paths_(paths), callback_(callback), buffers_(buffers), slots_(slots) {
+        for (unsigned i = 0; i < count; ++i) {
+            threads_.emplace_back([this] { run(); });
+        }
+    }
+
+    ~WorkerPool() { finish(); }
+
+    void push(const Job& job) {
+        {
+            std::lock_guard lock(mutex_);
+            queue_.push_back(job);
+        }
+        ready_.notify_one();
+    }
+
+    // Drains the queue and joins every worker
+    void finish() {
+        {
+            std::lock_guard lock(mutex_);
+            closing_ = true;
+        }
+        ready_.notify_all();
+        for (auto& thread : threads_) {
+            if (thread.joinable()) thread.join();
+        }
+    }
+};
+
+#ifdef DB25_HAVE_POSIX_IO
+
+// Copies the part of a file that did not fit its buffer into the slot's spill area
+int read_spill(int fd, BufferPool& buffers, unsigned slot, size_t& size) {
+    struct stat st;
+    if (::fstat(fd, &st) != 0) return errno;
+
+    size_t total = static_cast<size_t>(st.st_size);
+    if (total <= size) return 0;
+
+    auto& spill = buffers.spill[slot];
+    spill.resize(total);
+    std::memcpy(spill.data(), buffers.buffer(slot), size);
+    while (size < total) {
+        ssize_t n = ::pread(fd, spill.data() + size, total - size, static_cast<off_t>(size));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return errno;
+        }
+        if (n == 0) break;
+        size += static_cast<size_t>(n);
+    }
+    spill.resize(size);
+    return 0;
+}
+
+#ifdef DB25_HAVE_IO_URING
+
+// Fills the rest of a slot's buffer from offset `size` until EOF or full
+int read_rest(int fd, BufferPool& buffers, unsigned slot, size_t& size) {
+    while (size < buffers.buffer_size) {
+        ssize_t n = ::pread(fd, buffers.buffer(slot) + size, buffers.buffer_size - size, static_cast<off_t>(size));
+        if (n < 0 && errno == ESPIPE) {
+            n = ::read(fd, buffers.buffer(slot) + size, buffers.buffer_size - size);
+        }
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return errno;
+        }
+        if (n == 0) break;
+        size += static_cast<size_t>(n);
+    }
+    return 0;
+}
+
+#endif
+
+void ingest_blocking(std::span<const std::filesystem::path> paths, BufferPool& buffers,
+                     SlotPool& slots, WorkerPool& workers) {
+    for (size_t file = 0; file < paths.size(); ++file) {
+        unsigned slot = slots.acquire();
+
+        int fd = ::open(paths[file].c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            workers.push({file, slot, 0, errno});
+            continue;
+        }
+
+        size_t size = 0;
+        int error = 0;
+        while (size < buffers.buffer_size) {
+            ssize_t n = ::read(fd, buffers.buffer(slot) + size, buffers.buffer_size - size);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                error = errno;
+                break;
+            }
+            if (n == 0) break;
+            size += static_cast<size_t>(n);
+        }
+        if (error == 0 && size == buffers.buffer_size) {
+            error = read_spill(fd, buffers, slot, size);
+        }
+        ::close(fd);
+
+        workers.push({file, slot, error ? 0 : size, error});
+    }
+}
+
+#else
+
+void ingest_blocking(std::span<const std::filesystem::path> paths, BufferPool& buffers,
+                     SlotPool& slots, WorkerPool& workers) {
+    for (size_t file = 0; file < paths.size(); ++file) {
+        unsigned slot = slots.acquire();
+        std::ifstream in(paths[file], std::ios::binary);
+        if (!in) {
+            workers.push({file, slot, 0, ENOENT});
+            continue;
+        }
+        auto& spill = buffers.spill[slot];
+        spill.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        if (spill.empty()) spill.shrink_to_fit();
+        workers.push({file, slot, spill.size(), 0});
+    }
+}
+
+#endif
+
+#ifdef DB25_HAVE_IO_URING
+
+// Minimal io_uring wrapper over the raw syscalls (no liburing dependency)
+class IoUring {
+private:
+    int fd_ = -1;
+    void* sq_ring_ = MAP_FAILED;
+    void* cq_ring_ = MAP_FAILED;
+    size_t sq_ring_size_ = 0;
+    size_t cq_ring_size_ = 0;
+    io_uring_sqe* sqes_ = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqes_size_ = 0;
+
+    unsigned* sq_head_ = nullptr;
+    unsigned* sq_tail_ = nullptr;
+    unsigned* sq_array_ = nullptr;
+    unsigned sq_mask_ = 0;
+    unsigned sq_entries_ = 0;
+    unsigned local_tail_ = 0;
+
+    unsigned* cq_head_ = nullptr;
+    unsigned* cq_tail_ = nullptr;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe* cqes_ = nullptr;
+
+    static unsigned load_acquire(unsigned* p) noexcept {
+        return std::atomic_ref<unsigned>(*p).load(std::memory_order_acquire);
+    }
+    static void store_release(unsigned* p, unsigned v) noexcept {
+        std::atomic_ref<unsigned>(*p).store(v, std::memory_order_release);
+    }
+
+public:
+    IoUring() = default;
+    IoUring(const IoUring&) = delete;
+    IoUring& operator=(const IoUring&) = delete;
+
+    ~IoUring() {
+        if (sqes_ != MAP_FAILED) ::munmap(sqes_, sqes_size_);
+        if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_) ::munmap(cq_ring_, cq_ring_size_);
+        if (sq_ring_ != MAP_FAILED) ::munmap(sq_ring_, sq_ring_size_);
+        if (fd_ >= 0) ::close(fd_);
+    }
+
+    // Returns 0 or an errno value
+    int init(unsigned entries) noexcept {
+        io_uring_params params{};
+        int fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0) return errno;
+        fd_ = fd;
+
+        sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) {
+            sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+        }
+
+        sq_ring_ = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+        if (sq_ring_ == MAP_FAILED) return errno;
+
+        if (single_mmap) {
+            cq_ring_ = sq_ring_;
+        } else {
+            cq_ring_ = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                              MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+            if (cq_ring_ == MAP_FAILED) return errno;
+        }
+
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqes = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) return errno;
+        sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+        auto* sq = static_cast<std::byte*>(sq_ring_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_entries_ = params.sq_entries;
+        local_tail_ = *sq_tail_;
+
+        auto* cq = static_cast<std::byte*>(cq_ring_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return 0;
+    }
+
+    [[nodiscard]] unsigned entries() const noexcept { return sq_entries_; }
+
+    [[nodiscard]] bool supports(std::initializer_list<uint8_t> opcodes) const noexcept {
+        constexpr unsigned max_ops = 256;
+        std::vector<std::byte> storage(sizeof(io_uring_probe) + max_ops * sizeof(io_uring_probe_op));
+        auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+        if (::syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PROBE, probe, max_ops) < 0) {
+            return false;
+        }
+        return std::all_of(opcodes.begin(), opcodes.end(), [&](uint8_t op) {
+            return op <= probe->last_op && (probe->ops[op].flags & IO_URING_OP_SUPPORTED);
+        });
+    }
+
+    [[nodiscard]] bool register_buffers(const std::vector<iovec>& iovecs) noexcept {
+        return ::syscall(__NR_io_uring_register, fd_, IORING_REGISTER_BUFFERS,
+                         iovecs.data(), static_cast<unsigned>(iovecs.size())) == 0;
+    }
+
+    // Next free submission entry, zeroed; nullptr when the SQ is full
+    [[nodiscard]] io_uring_sqe* get_sqe() noexcept {
+        if (local_tail_ - load_acquire(sq_head_) >= sq_entries_) {
+            return nullptr;
+        }
+        unsigned index = local_tail_ & sq_mask_;
+        io_uring_sqe* sqe = &sqes_[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sq_array_[index] = index;
+        ++local_tail_;
+        return sqe;
+    }
+
+    // Submits pending entries and waits for `wait_nr` completions; returns 0 or an errno value
+    int submit_and_wait(unsigned wait_nr) noexcept {
+        store_release(sq_tail_, local_tail_);
+        for (;;) {
+            unsigned to_submit = local_tail_ - load_acquire(sq_head_);
+            long r = ::syscall(__NR_io_uring_enter, fd_, to_submit, wait_nr,
+                               wait_nr ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0);
+            if (r >= 0) return 0;
+            if (errno == EINTR) continue;
+            // Completion queue backed up: caller reaps and retries
+            if (errno == EBUSY || errno == EAGAIN) return 0;
+            return errno;
+        }
+    }
+
+    // Waits for one completion without submitting; returns 0 or an errno value
+    int wait_completion() noexcept {
+        for (;;) {
+            long r = ::syscall(__NR_io_uring_enter, fd_, 0u, 1u, IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (r >= 0) return 0;
+            if (errno == EINTR) continue;
+            return errno;
+        }
+    }
+
+    // Queued entries the kernel has not consumed; they never complete
+    [[nodiscard]] unsigned unsubmitted() const noexcept {
+        return local_tail_ - load_acquire(sq_head_);
+    }
+
+    template<typename Func>
+    void for_each_completion(Func&& func) {
+        unsigned head = *cq_head_;
+        unsigned tail = load_acquire(cq_tail_);
+        while (head != tail) {
+            func(cqes_[head & cq_mask_]);
+            ++head;
+            // Publish progress eagerly so the handler can queue new work
+            store_release(cq_head_, head);
+            tail = load_acquire(cq_tail_);
+        }
+    }
+};
+
+enum class UringOp : uint64_t { Open = 0, Read = 1, Close = 2 };
+
+constexpr uint64_t pack_user_data(unsigned slot, UringOp op) noexcept {
+    return (uint64_t(slot) << 2) | static_cast<uint64_t>(op);
+}
+
+// Drives open -> read -> close for every file through the ring.
+// Returns 0 or an errno value for a fatal ring error.
+int ingest_io_uring(IoUring& ring, bool fixed_buffers,
+                    std::span<const std::filesystem::path> paths, BufferPool& buffers,
+                    SlotPool& slots, WorkerPool& workers) {
+    struct SlotState {
+        size_t file = 0;
+        int fd = -1;
+        size_t size = 0;    // Bytes read so far
+    };
+    std::vector<SlotState> state(buffers.count);
+
+    size_t next_file = 0;
+    unsigned inflight = 0;
+
+    auto sqe_or_flush = [&]() -> io_uring_sqe* {
+        io_uring_sqe* sqe = ring.get_sqe();
+        if (sqe == nullptr) {
+            ring.submit_and_wait(0);
+            sqe = ring.get_sqe();
+        }
+        return sqe;
+    };
+
+    auto prep_read = [&](io_uring_sqe* sqe, unsigned slot) {
+        sqe->opcode = fixed_buffers ? IORING_OP_READ_FIXED : IORING_OP_READ;
+        sqe->fd = state[slot].fd;
+        sqe->addr = reinterpret_cast<uint64_t>(buffers.buffer(slot) + state[slot].size);
+        sqe->len = static_cast<uint32_t>(buffers.buffer_size - state[slot].size);
+        sqe->off = state[slot].size;
+        sqe->buf_index = static_cast<uint16_t>(slot);
+        sqe->user_data = pack_user_data(slot, UringOp::Read);
+    };
+
+    auto prep_close = [&](io_uring_sqe* sqe, unsigned slot) {
+        sqe->opcode = IORING_OP_CLOSE;
+        sqe->fd = state[slot].fd;
+        sqe->user_data = pack_user_data(slot, UringOp::Close);
+        state[slot].fd = -1;
+    };
+
+    while (next_file < paths.size() || inflight > 0) {
+        // Start as many opens as there are free buffers and ring capacity
+        unsigned slot;
+        while (next_file < paths.size() && inflight + 1 < ring.entries() && slots.try_acquire(slot)) {
+            io_uring_sqe* sqe = ring.get_sqe();
+            if (sqe == nullptr) {
+                slots.release(slot);
+                break;
+            }
+            state[slot].file = next_file++;
+            sqe->opcode = IORING_OP_OPENAT;
+            sqe->fd = AT_FDCWD;
+            sqe->addr = reinterpret_cast<uint64_t>(paths[state[slot].file].c_str());
+            sqe->open_flags = O_RDONLY | O_CLOEXEC;
+            sqe->user_data = pack_user_data(slot, UringOp::Open);
+            ++inflight;
+        }
+
+        if (inflight == 0) {
+            // Every buffer is still being tokenized
+            slots.wait_available();
+            continue;
+        }
+
+        if (int error = ring.submit_and_wait(1); error != 0) {
+            // Reads in flight still target `buffers`: wait them out before
+            // the caller frees them, or leak the buffers if that fails too
+            while (inflight > ring.unsubmitted()) {
+                ring.for_each_completion([&](const io_uring_cqe& cqe) {
+                    --inflight;
+                    if (static_cast<UringOp>(cqe.user_data & 3) == UringOp::Open && cqe.res >= 0) {
+                        ::close(cqe.res);
+                    }
+                });
+                if (inflight > ring.unsubmitted() && ring.wait_completion() != 0) {
+                    buffers.abandon();
+                    break;
+                }
+            }
+            for (SlotState& open : state) {
+                if (open.fd >= 0) ::close(std::exchange(open.fd, -1));
+            }
+            return error;
+        }
+
+        ring.for_each_completion([&](const io_uring_cqe& cqe) {
+            --inflight;
+            unsigned slot = static_cast<unsigned>(cqe.user_data >> 2);
+            auto op = static_cast<UringOp>(cqe.user_data & 3);
+
+            switch (op) {
+                case UringOp::Open:
+                    if (cqe.res < 0) {
+                        workers.push({state[slot].file, slot, 0, -cqe.res});
+                        break;
+                    }
+                    state[slot].fd = cqe.res;
+                    state[slot].size = 0;
+                    if (io_uring_sqe* sqe = sqe_or_flush()) {
+                        prep_read(sqe, slot);
+                        ++inflight;
+                    } else {
+                        ::close(std::exchange(state[slot].fd, -1));
+                        workers.push({state[slot].file, slot, 0, EAGAIN});
+                    }
+                    break;
+
+                case UringOp::Read: {
+                    int error = cqe.res < 0 ? -cqe.res : 0;
+                    if (cqe.res > 0) {
+                        state[slot].size += static_cast<size_t>(cqe.res);
+                        // Short read: continue where it stopped until EOF (0) or a full buffer
+                        if (state[slot].size < buffers.buffer_size) {
+                            if (io_uring_sqe* sqe = sqe_or_flush()) {
+                                prep_read(sqe, slot);
+                                ++inflight;
+                                break;
+                            }
+                            error = read_rest(state[slot].fd, buffers, slot, state[slot].size);
+                        }
+                    }
+                    size_t size = state[slot].size;
+                    if (error == 0 && size == buffers.buffer_size) UNLIKELY {
+                        error = read_spill(state[slot].fd, buffers, slot, size);
+                    }
+                    int fd = state[slot].fd;
+                    if (io_uring_sqe* sqe = sqe_or_flush()) {
+                        prep_close(sqe, slot);
+                        ++inflight;
+                    } else {
+                        ::close(fd);
+                    }
+                    // The close only touches the descriptor; the buffer goes to a worker now
+                    workers.push({state[slot].file, slot, error ? 0 : size, error});
+                    break;
+                }
+
+                case UringOp::Close:
+                    break;
+            }
+        });
+    }
+
+    return 0;
+}
+
+#endif
+
+}  // namespace
+
+bool io_uring_available() noexcept {
+    #ifdef DB25_HAVE_IO_URING
+    static const bool available = [] {
+        IoUring ring;
+        return ring.init(4) == 0 &&
+               ring.supports({IORING_OP_OPENAT, IORING_OP_READ_FIXED, IORING_OP_READ, IORING_OP_CLOSE});
+    }();
+    return available;
+    #else
+    return false;
+    #endif
+}
+
+IngestStats ingest_files(std::span<const std::filesystem::path> paths,
+                         const IngestCallback& on_file,
+                         const IngestOptions& options) {
+    auto start = std::chrono::steady_clock::now();
+
+    unsigned depth = std::clamp(options.queue_depth, 1u, 4096u);
+    unsigned worker_count = options.workers ? options.workers
+                                            : std::max(1u, std::thread::hardware_concurrency());
+
+    BufferPool buffers(depth, options.buffer_size);
+    SlotPool slots(depth);
+    IngestStats stats;
+    int fatal = 0;
+
+    {
+        WorkerPool workers(worker_count, paths, on_file, buffers, slots);
+
+        #ifdef DB25_HAVE_IO_URING
+        IoUring ring;
+        if (options.use_io_uring && io_uring_available() &&
+            ring.init(std::bit_ceil(std::max(8u, depth * 2))) == 0) {
+            std::vector<iovec> iovecs(depth);
+            for (unsigned i = 0; i < depth; ++i) {
+                iovecs[i] = {buffers.buffer(i), buffers.buffer_size};
+            }
+            bool fixed = ring.register_buffers(iovecs);
+            fatal = ingest_io_uring(ring, fixed, paths, buffers, slots, workers);
+            stats.used_io_uring = true;
+        } else {
+            ingest_blocking(paths, buffers, slots, workers);
+        }
+        #else
+        ingest_blocking(paths, buffers, slots, workers);
+        #endif
+
+        workers.finish();
+        stats.files = workers.files.load();
+        stats.failed = workers.failed.load();
+        stats.bytes = workers.bytes.load();
+        stats.tokens = workers.token_count.load();
+    }
+
+    if (fatal != 0) {
+        throw std::system_error(fatal, std::generic_category(), "io_uring_enter");
+    }
+
+    stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return stats;
+}
+
+}  // namespace db25
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "dollar_quote.hpp"
+#include "grammar_dispatch.hpp"
+#include "simd_block_scan.hpp"
+#include <bit>
+#include <cstring>
+
+namespace db25 {
+
+namespace {
+
+enum Mask : size_t { DOLLAR, NEWLINE };
+constexpr std::array<uint8_t, 2> QUOTE_CHARS = {'$', '\n'};
+
+constexpr bool is_word_char(uint8_t c) noexcept {
+    return GrammarDispatch::is_identifier_cont(c) || c >= 0x80;
+}
+
+template<typename Processor>
+DollarQuoteMatch find_end_impl(Processor processor, const uint8_t* data, size_t size, size_t begin,
+                               std::string_view tag) {
+    DollarQuoteMatch match{size, 0, 0};
+    uint8_t scratch[SCAN_BLOCK_SIZE];
+
+    auto count_newlines = [&](size_t block, uint64_t newlines) {
+        if (newlines != 0) {
+            match.newlines += static_cast<size_t>(std::popcount(newlines));
+            match.last_newline = block + 63 - static_cast<size_t>(std::countl_zero(newlines));
+        }
+    };
+
+    for (size_t block = begin; block < size; block += SCAN_BLOCK_SIZE) {
+        const auto masks = match_block(processor, load_scan_block(data, size, block, scratch), QUOTE_CHARS);
+        uint64_t candidates = masks[DOLLAR];
+        while (candidates != 0) {
+            size_t i = block + std::countr_zero(candidates);
+            if (size - i >= tag.size() && std::memcmp(data + i, tag.data(), tag.size()) == 0) {
+                count_newlines(block, masks[NEWLINE] & ((uint64_t(1) << (i - block)) - 1));
+                match.end = i + tag.size();
+                return match;
+            }
+            candidates &= candidates - 1;
+        }
+        // Zero-padded tail bytes never match '\n'
+        count_newlines(block, masks[NEWLINE]);
+    }
+    return match;
+}
+
+}  // namespace
+
+size_t dollar_quote_open(const std::byte* input, size_t size, size_t start) noexcept {
+    const auto* data = reinterpret_cast<const uint8_t*>(input);
+    if (data[start] != '$' || (start > 0 && is_word_char(data[start - 1]))) {
+        return 0;
+    }
+    size_t i = start + 1;
+    if (i < size && (GrammarDispatch::is_identifier_start(data[i]) || data[i] >= 0x80)) {
+        while (i < size && is_word_char(data[i])) ++i;
+    }
+    return i < size && data[i] == '$' ? i + 1 - start : 0;
+}
+
+DollarQuoteMatch find_dollar_quote_end(const std::byte* input, size_t size, size_t body_begin,
+                                       std::string_view tag) {
+    const auto* data = reinterpret_cast<const uint8_t*>(input);
+    SimdDispatcher dispatcher;
+    return dispatcher.dispatch([&](auto processor) {
+        return find_end_impl(processor, data, size, body_begin, tag);
+    });
+}
+
+}  // namespace db25
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "huge_token_buffer.hpp"
+#include "optimization_hints.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <system_error>
+#include <utility>
+
+#if defined(__linux__)
+    #define DB25_HAVE_MREMAP 1
+    #include <sys/mman.h>
+#endif
+
+namespace db25 {
+
+namespace {
+
+constexpr size_t HUGE_PAGE = 2u << 20;
+constexpr size_t CACHE_LINE = 64;
+constexpr size_t PREFETCH_BATCH = 1024;
+
+// Whole huge pages, so growth never splits one
+size_t round_to_huge_page(size_t bytes) noexcept {
+    return (bytes + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+}
+
+[[noreturn]] void throw_errno(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+}  // namespace
+
+#ifdef DB25_HAVE_MREMAP
+
+void HugeTokenBuffer::grow(size_t min_capacity) {
+    size_t old_bytes = capacity_ * sizeof(Token);
+    size_t bytes = round_to_huge_page(std::max(min_capacity * sizeof(Token), old_bytes * 2));
+
+    void* addr;
+    if (data_ == nullptr) {
+        addr = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (addr == MAP_FAILED) {
+            throw_errno("mmap token buffer");
+        }
+    } else {
+        // Moves page table entries; the tokens themselves are not copied
+        addr = ::mremap(data_, old_bytes, bytes, MREMAP_MAYMOVE);
+        if (addr == MAP_FAILED) {
+            throw_errno("mremap token buffer");
+        }
+    }
+    #ifdef MADV_HUGEPAGE
+    if (huge_pages_) {
+        ::madvise(addr, bytes, MADV_HUGEPAGE);   // Best effort
+    }
+    #endif
+
+    data_ = static_cast<Token*>(addr);
+    capacity_ = bytes / sizeof(Token);
+}
+
+void HugeTokenBuffer::release() noexcept {
+    if (data_ != nullptr) {
+        ::munmap(data_, capacity_ * sizeof(Token));
+    }
+    data_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+}
+
+#else
+
+void HugeTokenBuffer::grow(size_t min_capacity) {
+    size_t bytes = round_to_huge_page(std::max(min_capacity, capacity_ * 2) * sizeof(Token));
+    void* addr = std::realloc(data_, bytes);
+    if (addr == nullptr) {
+        throw std::system_error(std::make_error_code(std::errc::not_enough_memory), "realloc token buffer");
+    }
+    data_ = static_cast<Token*>(addr);
+    capacity_ = bytes / sizeof(Token);
+}
+
+void HugeTokenBuffer::release() noexcept {
+    std::free(data_);
+    data_ = nullptr;
+    size_ = 0;
+    capacity_ = 0;
+}
+
+#endif
+
+HugeTokenBuffer::HugeTokenBuffer(HugeTokenBuffer&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr))
+    , size_(std::exchange(other.size_, 0))
+    , capacity_(std::exchange(other.capacity_, 0))
+    , huge_pages_(other.huge_pages_) {}
+
+HugeTokenBuffer& HugeTokenBuffer::operator=(HugeTokenBuffer&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        capacity_ = std::exchange(other.capacity_, 0);
+        huge_pages_ = other.huge_pages_;
+    }
+    return *this;
+}
+
+size_t tokenize_huge(const std::byte* input, size_t size, HugeTokenBuffer& out, const HugeBufferOptions& options) {
+    const size_t first = out.size();
+    out.reserve(first + size / 8);   // Same estimate as tokenize(); growth is cheap anyway
+
+    SimdTokenizer tokenizer(input, size);
+    const auto* base = reinterpret_cast<const char*>(input);
+    size_t next_batch = options.prefetch_distance != 0 ? 0 : SIZE_MAX;
+    Token token;
+    while (tokenizer.next(token)) {
+        // Each time the lexer enters a new batch, prefetch one batch of lines
+        // `prefetch_distance` bytes ahead of it
+        if (static_cast<size_t>(token.value.data() - base) >= next_batch) UNLIKELY {
+            size_t from = next_batch + options.prefetch_distance;
+            size_t to = std::min(size, from + PREFETCH_BATCH);
+            for (size_t line = from; line < to; line += CACHE_LINE) {
+                PREFETCH(base + line, 0, 1);
+            }
+            next_batch += PREFETCH_BATCH;
+        }
+        if (options.streaming_stores) {
+            out.stream_back(token);
+        } else {
+            out.push_back(token);
+        }
+    }
+    out.fence();
+    return out.size() - first;
+}
+
+}  // namespace db25
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "literal_rows.hpp"
+#include "simd_block_scan.hpp"
+#include <bit>
+
+namespace db25 {
+
+namespace {
+
+enum class RowState : uint8_t {
+    BeforeRow,      // Expecting '('
+    InField,        // Inside a tuple, before or within a bare literal
+    InString,       // Inside a '...' literal
+    AfterString,    // After a string literal, expecting ',' or ')'
+    AfterRow        // After ')', expecting ',' or the end of the list
+};
+
+// Order of the bytes classified per block
+enum Mask : size_t { SQUOTE, COMMA, LPAREN, RPAREN };
+constexpr std::array<uint8_t, 4> ROW_CHARS = {'\'', ',', '(', ')'};
+constexpr std::array<uint8_t, 1> NEWLINE_CHAR = {'\n'};
+
+constexpr bool is_space(uint8_t c) noexcept {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+bool all_space(const uint8_t* data, size_t from, size_t to) noexcept {
+    for (; from < to; ++from) {
+        if (!is_space(data[from])) return false;
+    }
+    return true;
+}
+
+bool equals_upper(const uint8_t* p, size_t n, std::string_view word) noexcept {
+    if (n != word.size()) return false;
+    for (size_t i = 0; i < n; ++i) {
+        if ((p[i] & 0xDF) != static_cast<uint8_t>(word[i])) return false;
+    }
+    return true;
+}
+
+// [+-] digits [. digits] [e [+-] digits], or a literal keyword
+bool is_bare_literal(const uint8_t* p, size_t n) noexcept {
+    if (n == 0) return false;
+    if (equals_upper(p, n, "NULL") || equals_upper(p, n, "TRUE") || equals_upper(p, n, "FALSE") ||
+        equals_upper(p, n, "DEFAULT")) {
+        return true;
+    }
+    size_t i = p[0] == '-' || p[0] == '+' ? 1 : 0;
+    size_t digits = 0;
+    for (; i < n && p[i] >= '0' && p[i] <= '9'; ++i) ++digits;
+    if (i < n && p[i] == '.') {
+        for (++i; i < n && p[i] >= '0' && p[i] <= '9'; ++i) ++digits;
+    }
+    if (digits == 0) return false;
+    if (i < n && (p[i] == 'e' || p[i] == 'E')) {
+        ++i;
+        if (i < n && (p[i] == '-' || p[i] == '+')) ++i;
+        size_t exponent = 0;
+        for (; i < n && p[i] >= '0' && p[i] <= '9'; ++i) ++exponent;
+        if (exponent == 0) return false;
+    }
+    return i == n;
+}
+
+template<typename Processor>
+LiteralRowsMatch scan_impl(Processor processor, const uint8_t* data, size_t size, size_t start,
+                           size_t max_rows, LiteralRowIndex& index) {
+    std::vector<LiteralField>& fields = index.fields;
+    const size_t first_field = fields.size();
+    RowState state = RowState::BeforeRow;
+    size_t gap = start;             // First byte after the last event
+    size_t field_start = 0;         // Bare literal / string start
+    size_t row_first = first_field; // First field of the open row
+    uint32_t width = 0;
+    uint32_t rows = 0;
+    size_t end = start;             // After the last complete row
+    bool done = false;
+    uint8_t scratch[SCAN_BLOCK_SIZE];
+
+    // Trims [from, to) and appends it; false if `bare` and it is not a bare literal
+    auto push_field = [&](size_t from, size_t to, bool bare) {
+        while (from < to && is_space(data[from])) ++from;
+        while (to > from && is_space(data[to - 1])) --to;
+        if (bare && !is_bare_literal(data + from, to - from)) return false;
+        fields.push_back({static_cast<uint32_t>(from - start), static_cast<uint32_t>(to - from)});
+        return true;
+    };
+
+    // Handles the ',' or ')' that ends a field; false ends the list
+    auto end_field = [&](size_t i, uint8_t ch) {
+        if (ch == ',') {
+            field_start = i + 1;
+            state = RowState::InField;
+            return true;
+        }
+        if (ch != ')') return false;
+        auto count = static_cast<uint32_t>(fields.size() - row_first);
+        if (rows == 0) {
+            width = count;
+        } else if (count != width) {
+            return false;
+        }
+        ++rows;
+        end = i + 1;
+        gap = i + 1;
+        row_first = fields.size();
+        state = RowState::AfterRow;
+        return rows < max_rows;
+    };
+
+    auto handle = [&](size_t i, uint8_t ch) -> size_t {
+        if (i - start >= UINT32_MAX) {
+            return 0;   // Field offsets are 32-bit
+        }
+        switch (state) {
+            case RowState::BeforeRow:
+                if (ch != '(' || !all_space(data, gap, i)) return 0;
+                state = RowState::InField;
+                field_start = i + 1;
+                return i + 1;
+
+            case RowState::InField:
+                if (ch == '\'') {
+                    if (!all_space(data, field_start, i)) return 0;
+                    field_start = i;
+                    state = RowState::InString;
+                    return i + 1;
+                }
+                if (ch == '(' || !push_field(field_start, i, true)) return 0;
+                return end_field(i, ch) ? i + 1 : 0;
+
+            case RowState::InString:
+                if (i + 1 < size && data[i + 1] == '\'') {
+                    return i + 2;   // Doubled quote is an escaped quote
+                }
+                state = RowState::AfterString;
+                gap = i + 1;
+                return i + 1;
+
+            case RowState::AfterString:
+                if ((ch != ',' && ch != ')') || !all_space(data, gap, i)) return 0;
+                push_field(field_start, gap, false);
+                return end_field(i, ch) ? i + 1 : 0;
+
+            case RowState::AfterRow:
+                if (ch != ',' || !all_space(data, gap, i)) return 0;
+                state = RowState::BeforeRow;
+                gap = i + 1;
+                return i + 1;
+        }
+        return 0;
+    };
+
+    size_t pos = start;
+    for (size_t block = start; block < size && !done; block += SCAN_BLOCK_SIZE) {
+        const auto masks = match_block(processor, load_scan_block(data, size, block, scratch), ROW_CHARS);
+        const uint64_t structural = masks[SQUOTE] | masks[COMMA] | masks[LPAREN] | masks[RPAREN];
+        const uint64_t in_block = size - block >= SCAN_BLOCK_SIZE ? ~uint64_t(0)
+                                                                   : (uint64_t(1) << (size - block)) - 1;
+
+        while (pos < block + SCAN_BLOCK_SIZE) {
+            uint64_t candidates = (state == RowState::InString ? masks[SQUOTE] : structural) & in_block;
+            if (pos > block) {
+                candidates &= ~uint64_t(0) << (pos - block);
+            }
+            if (candidates == 0) {
+                break;
+            }
+            size_t i = block + std::countr_zero(candidates);
+            pos = handle(i, data[i]);
+            if (pos == 0) {
+                done = true;
+                break;
+            }
+        }
+    }
+
+    // Drop the fields of an unfinished or rejected row
+    fields.resize(row_first);
+    if (rows == 0) {
+        fields.resize(first_field);
+        return {start, 0, 0};
+    }
+
+    LiteralRowsMatch match{end, 0, 0};
+    for (size_t block = start; block < end; block += SCAN_BLOCK_SIZE) {
+        uint64_t newlines = match_block(processor, load_scan_block(data, end, block, scratch), NEWLINE_CHAR)[0];
+        if (end - block < SCAN_BLOCK_SIZE) {
+            newlines &= (uint64_t(1) << (end - block)) - 1;
+        }
+        if (newlines != 0) {
+            match.newlines += static_cast<size_t>(std::popcount(newlines));
+            match.last_newline = block + 63 - static_cast<size_t>(std::countl_zero(newlines));
+        }
+    }
+    index.lists.push_back({start, end, rows, width, first_field});
+    return match;
+}
+
+}  // namespace
+
+LiteralRowsMatch scan_literal_rows(const std::byte* input, size_t size, size_t start, size_t max_rows,
+                                   LiteralRowIndex& index) {
+    const auto* data = reinterpret_cast<const uint8_t*>(input);
+    if (start >= size || data[start] != '(' || max_rows == 0) {
+        return {start, 0, 0};
+    }
+    SimdDispatcher dispatcher;
+    return dispatcher.dispatch([&](auto processor) {
+        return scan_impl(processor, data, size, start, max_rows, index);
+    });
+}
+
+}  // namespace db25
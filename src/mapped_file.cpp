@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "mapped_file.hpp"
+#include <cerrno>
+#include <fstream>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define DB25_HAVE_MMAP 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace db25 {
+
+#ifdef DB25_HAVE_MMAP
+
+namespace {
+
+[[noreturn]] void throw_errno(const char* what, const std::filesystem::path& path) {
+    throw std::system_error(errno, std::generic_category(),
+                            std::string(what) + " " + path.string());
+}
+
+}  // namespace
+
+MappedFile::MappedFile(const std::filesystem::path& path, MapOptions options) {
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw_errno("open", path);
+    }
+    
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        int saved = errno;
+        ::close(fd);
+        errno = saved;
+        throw_errno("fstat", path);
+    }
+    
+    size_t size = static_cast<size_t>(st.st_size);
+    if (size == 0) {
+        ::close(fd);
+        return;
+    }
+    
+    int flags = MAP_PRIVATE;
+    #ifdef MAP_POPULATE
+    if (options.populate) {
+        flags |= MAP_POPULATE;
+    }
+    #endif
+    
+    void* addr = ::mmap(nullptr, size, PROT_READ, flags, fd, 0);
+    int saved = errno;
+    ::close(fd);   // The mapping keeps its own reference to the file
+    if (addr == MAP_FAILED) {
+        errno = saved;
+        throw_errno("mmap", path);
+    }
+    
+    // Advice is best effort; failures only cost performance
+    if (options.sequential) {
+        ::madvise(addr, size, MADV_SEQUENTIAL);
+    }
+    #ifdef MADV_HUGEPAGE
+    if (options.huge_pages) {
+        ::madvise(addr, size, MADV_HUGEPAGE);
+    }
+    #endif
+    
+    data_ = static_cast<const std::byte*>(addr);
+    size_ = size;
+}
+
+void MappedFile::unmap() noexcept {
+    if (data_ != nullptr && fallback_.empty()) {
+        ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    fallback_.clear();
+}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path& path, MapOptions) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory),
+                                "open " + path.string());
+    }
+    fallback_.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(fallback_.data()), static_cast<std::streamsize>(fallback_.size()));
+    data_ = fallback_.data();
+    size_ = fallback_.size();
+}
+
+void MappedFile::unmap() noexcept {
+    data_ = nullptr;
+    size_ = 0;
+    fallback_.clear();
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+    unmap();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr))
+    , size_(std::exchange(other.size_, 0))
+    , fallback_(std::move(other.fallback_)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        fallback_ = std::move(other.fallback_);
+    }
+    return *this;
+}
+
+TokenizedFile tokenize_file(const std::filesystem::path& path, MapOptions options) {
+    MappedFile file(path, options);
+    SimdTokenizer tokenizer(file.data(), file.size());
+    auto tokens = tokenizer.tokenize();
+    return TokenizedFile(std::move(file), std::move(tokens));
+}
+
+}  // namespace db25
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "psql_script.hpp"
+#include "simd_block_scan.hpp"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+namespace db25 {
+
+namespace {
+
+enum Mask : size_t { NEWLINE, BACKSLASH };
+constexpr std::array<uint8_t, 2> DATA_CHARS = {'\n', '\\'};
+
+constexpr bool is_word_char(uint8_t c) noexcept {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+           c == '_' || c == '$' || c >= 0x80;
+}
+
+bool equals_upper(std::string_view word, std::string_view upper) noexcept {
+    if (word.size() != upper.size()) return false;
+    for (size_t i = 0; i < word.size(); ++i) {
+        if ((static_cast<uint8_t>(word[i]) & 0xDF) != static_cast<uint8_t>(upper[i])) return false;
+    }
+    return true;
+}
+
+// "\." followed by a line end or the end of the input
+bool is_terminator(const uint8_t* data, size_t size, size_t i) noexcept {
+    return i + 1 < size && data[i + 1] == '.' &&
+           (i + 2 == size || data[i + 2] == '\n' || data[i + 2] == '\r');
+}
+
+template<typename Processor>
+CopyDataMatch find_end_impl(Processor processor, const uint8_t* data, size_t size, size_t begin) {
+    CopyDataMatch match{size, 0};
+    uint8_t scratch[SCAN_BLOCK_SIZE];
+    uint64_t carry = 1;   // `begin` is a line start
+
+    for (size_t block = begin; block < size; block += SCAN_BLOCK_SIZE) {
+        const auto masks = match_block(processor, load_scan_block(data, size, block, scratch), DATA_CHARS);
+        uint64_t line_starts = (masks[NEWLINE] << 1) | carry;
+        carry = masks[NEWLINE] >> 63;
+
+        uint64_t candidates = masks[BACKSLASH] & line_starts;
+        while (candidates != 0) {
+            size_t i = block + std::countr_zero(candidates);
+            if (is_terminator(data, size, i)) {
+                uint64_t before = masks[NEWLINE] & ((uint64_t(1) << (i - block)) - 1);
+                match.end = i;
+                match.newlines += static_cast<size_t>(std::popcount(before));
+                return match;
+            }
+            candidates &= candidates - 1;
+        }
+        // Zero-padded tail bytes never match '\n'
+        match.newlines += static_cast<size_t>(std::popcount(masks[NEWLINE]));
+    }
+    return match;
+}
+
+}  // namespace
+
+bool is_copy_from_stdin(std::string_view statement) noexcept {
+    const auto* data = reinterpret_cast<const uint8_t*>(statement.data());
+    const size_t size = statement.size();
+    size_t i = 0;
+    bool first = true;
+    bool after_from = false;
+
+    while (i < size) {
+        uint8_t ch = data[i];
+        uint8_t next = i + 1 < size ? data[i + 1] : 0;
+        if (ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r') {
+            ++i;
+        } else if (ch == '-' && next == '-') {
+            while (i < size && data[i] != '\n') ++i;
+        } else if (ch == '/' && next == '*') {
+            for (i += 2; i + 1 < size && !(data[i] == '*' && data[i + 1] == '/'); ++i) {}
+            i += 2;
+        } else if (is_word_char(ch)) {
+            size_t start = i;
+            while (i < size && is_word_char(data[i])) ++i;
+            std::string_view word(statement.data() + start, i - start);
+            if (first) {
+                if (!equals_upper(word, "COPY")) return false;
+                first = false;
+            } else if (after_from && equals_upper(word, "STDIN")) {
+                return true;
+            } else {
+                after_from = equals_upper(word, "FROM");
+            }
+        } else {
+            if (first) return false;
+            if (ch == '\'' || ch == '"') {
+                // Doubled quotes are escapes: each pair closes and reopens
+                for (++i; i < size && data[i] != ch; ++i) {}
+            }
+            ++i;
+            after_from = false;
+        }
+    }
+    return false;
+}
+
+size_t copy_data_begin(const std::byte* input, size_t size, size_t semicolon) noexcept {
+    const auto* data = reinterpret_cast<const uint8_t*>(input);
+    for (size_t i = semicolon + 1; i < size; ++i) {
+        if (data[i] == '\n') return i + 1;
+        if (data[i] != ' ' && data[i] != '\t' && data[i] != '\r') return SIZE_MAX;
+    }
+    return SIZE_MAX;
+}
+
+CopyDataMatch find_copy_data_end(const std::byte* input, size_t size, size_t begin) {
+    const auto* data = reinterpret_cast<const uint8_t*>(input);
+    SimdDispatcher dispatcher;
+    return dispatcher.dispatch([&](auto processor) {
+        return find_end_impl(processor, data, size, begin);
+    });
+}
+
+size_t meta_command_end(const std::byte* input, size_t size, size_t start) noexcept {
+    const auto* data = reinterpret_cast<const uint8_t*>(input);
+    const void* newline = std::memchr(data + start, '\n', size - start);
+    size_t end = newline != nullptr ? static_cast<size_t>(static_cast<const uint8_t*>(newline) - data) : size;
+    if (end > start + 1 && data[end - 1] == '\r') {
+        --end;
+    }
+    return end;
+}
+
+}  // namespace db25
@@ -9,21 +9,52 @@
  */
 
 #include "simd_tokenizer.hpp"
+#include "symbol_table.hpp"
+#include "utf8.hpp"
+#include "lexer_dfa.hpp"
+#include "psql_script.hpp"
+#include "dollar_quote.hpp"
+#include <algorithm>
 
 namespace db25 {
 
-SimdTokenizer::SimdTokenizer(const std::byte* input, size_t size)
+template<typename Policy>
+BasicSimdTokenizer<Policy>::BasicSimdTokenizer(const std::byte* input, size_t size)
         : input_(input)
         , input_size_(size)
         , position_(0)
         , line_(1)
-        , column_(1) {}
+        , column_(1)
+        , utf8_error_(size) {}
     
-[[nodiscard]] std::vector<Token> SimdTokenizer::tokenize() {
+template<typename Policy>
+[[nodiscard]] std::vector<Token> BasicSimdTokenizer<Policy>::tokenize() {
         std::vector<Token> tokens;
         tokens.reserve(input_size_ / 8);
         
-        while (position_ < input_size_) {
+        Token token;
+        while (next(token)) {
+            tokens.push_back(token);
+        }
+        
+        return tokens;
+    }
+    
+template<typename Policy>
+[[nodiscard]] bool BasicSimdTokenizer<Policy>::next(Token& out) {
+        for (;;) {
+            // Before the whitespace skip: data lines may start with blanks
+            if (copy_data_pending_) UNLIKELY {
+                copy_data_pending_ = false;
+                if (scan_copy_data(out)) {
+                    if (brackets_ != nullptr) {
+                        brackets_->record(token_index_, out.operator_kind());
+                    }
+                    ++token_index_;
+                    return true;
+                }
+            }
+            
             size_t skip = dispatcher_.dispatch([this](auto processor) {
                 return processor.skip_whitespace(
                     input_ + position_, 
@@ -36,37 +67,101 @@ SimdTokenizer::SimdTokenizer(const std::byte* input, size_t size)
             }
             
             if (position_ >= input_size_) {
-                break;
+                return false;
             }
             
-            Token token = next_token();
-            if (token.type != TokenType::Whitespace) {
-                tokens.push_back(token);
+            if (position_ >= utf8_checked_) {
+                validate_utf8_ahead();
             }
             
-            if (token.type == TokenType::EndOfFile) {
-                break;
+            if constexpr (!Policy::emit_comments) {
+                if (skip_comment()) {
+                    continue;
+                }
+            }
+            
+            const uint8_t lead = static_cast<uint8_t>(input_[position_]);
+            if (psql_script_ && lead == '\\') {
+                out = scan_meta_command();
+            } else if (dollar_quotes_ && lead == '$' && scan_dollar_quote(out)) {
+                // Body left unlexed
+            } else if (literal_rows_after_ == Keyword::UNKNOWN || literal_rows_ == nullptr || !scan_literal_list(out)) {
+                out = next_token();
+            }
+            if constexpr (Policy::keywords != KeywordMode::None) {
+                if (compound_keywords_ && out.type == TokenType::Keyword) {
+                    fuse_compound_keyword(out);
+                }
+                if (out.type != TokenType::Comment) {
+                    bool list_follows = out.type == TokenType::Keyword &&
+                        (out.keyword_id == Keyword::VALUES || out.keyword_id == Keyword::IN ||
+                         out.keyword_id == Keyword::NOT_IN);
+                    literal_rows_after_ = list_follows ? out.keyword_id : Keyword::UNKNOWN;
+                }
+            }
+            if (psql_script_) {
+                if (out.type == TokenType::MetaCommand) {
+                    statement_begin_ = position_;
+                } else if (out.operator_kind() == OperatorKind::Semicolon) {
+                    copy_data_pending_ = is_copy_from_stdin(
+                        std::string_view(reinterpret_cast<const char*>(input_ + statement_begin_),
+                                         position_ - 1 - statement_begin_));
+                    statement_begin_ = position_;
+                }
+            }
+            if (brackets_ != nullptr) {
+                brackets_->record(token_index_, out.operator_kind());
             }
+            ++token_index_;
+            return true;
         }
-        
-        return tokens;
     }
     
-[[nodiscard]] const char* SimdTokenizer::simd_level() const noexcept {
+template<typename Policy>
+[[nodiscard]] const char* BasicSimdTokenizer<Policy>::simd_level() const noexcept {
     return dispatcher_.level_name();
 }
 
-Token SimdTokenizer::next_token() {
+template<typename Policy>
+Token BasicSimdTokenizer<Policy>::next_token() {
         if (position_ >= input_size_) {
             return {TokenType::EndOfFile, "", line_, column_, Keyword::UNKNOWN};
         }
         
         size_t start = position_;
-        uint32_t start_line = line_;
-        uint32_t start_column = column_;
+        uint32_t start_line = Policy::track_positions ? line_ : 0;
+        uint32_t start_column = Policy::track_positions ? column_ : 0;
         
         uint8_t first_char = static_cast<uint8_t>(input_[position_]);
         
+        if constexpr (Policy::lexer == LexerKind::Dfa) {
+            bool comment_next = Policy::emit_comments && position_ + 1 < input_size_ &&
+                                static_cast<uint8_t>(input_[position_ + 1]) == (first_char == '-' ? '-' : '*');
+            switch (static_cast<LexStart>(LEX_START[first_char])) {
+                case LexStart::Word:
+                    return scan_identifier_or_keyword(start, start_line, start_column);
+                case LexStart::Number:
+                    return scan_number(start, start_line, start_column);
+                case LexStart::Quote:
+                    return scan_string(start, start_line, start_column, first_char);
+                case LexStart::Dash:
+                    if (comment_next) {
+                        return scan_comment(start, start_line, start_column);
+                    }
+                    break;
+                case LexStart::Slash:
+                    if (comment_next) {
+                        return scan_block_comment(start, start_line, start_column);
+                    }
+                    break;
+                case LexStart::NonAscii:
+                    return scan_invalid_or_identifier(start, start_line, start_column);
+                case LexStart::Operator:
+                    break;
+            }
+            return scan_operator_or_delimiter(start, start_line, start_column);
+        }
+        
         if ((first_char >= 'A' && first_char <= 'Z') ||
             (first_char >= 'a' && first_char <= 'z') ||
             first_char == '_') {
@@ -77,34 +172,71 @@ Token SimdTokenizer::next_token() {
             return scan_number(start, start_line, start_column);
         }
         
-        if (first_char == '\'' || first_char == '"') {
-            return scan_string(start, start_line, start_column, first_char);
+        if (first_char >= 0x80) {
+            return scan_invalid_or_identifier(start, start_line, start_column);
         }
         
-        if (first_char == '-' && position_ + 1 < input_size_ &&
-            static_cast<uint8_t>(input_[position_ + 1]) == '-') {
-            return scan_comment(start, start_line, start_column);
+        if (first_char == '\'' || first_char == '"') {
+            return scan_string(start, start_line, start_column, first_char);
         }
         
-        if (first_char == '/' && position_ + 1 < input_size_ &&
-            static_cast<uint8_t>(input_[position_ + 1]) == '*') {
-            return scan_block_comment(start, start_line, start_column);
+        // Without comment tokens next() has already consumed any comment here
+        if constexpr (Policy::emit_comments) {
+            if (first_char == '-' && position_ + 1 < input_size_ &&
+                static_cast<uint8_t>(input_[position_ + 1]) == '-') {
+                return scan_comment(start, start_line, start_column);
+            }
+            
+            if (first_char == '/' && position_ + 1 < input_size_ &&
+                static_cast<uint8_t>(input_[position_ + 1]) == '*') {
+                return scan_block_comment(start, start_line, start_column);
+            }
         }
         
         return scan_operator_or_delimiter(start, start_line, start_column);
     }
 
-Token SimdTokenizer::scan_identifier_or_keyword(size_t start, uint32_t start_line, uint32_t start_column) {
+// Multi-byte UTF-8 characters start identifiers; invalid bytes are
+// reported as single-byte Unknown tokens
+template<typename Policy>
+Token BasicSimdTokenizer<Policy>::scan_invalid_or_identifier(size_t start, uint32_t start_line, uint32_t start_column) {
+        if (utf8_length_at(position_) > 0) {
+            return scan_identifier_or_keyword(start, start_line, start_column);
+        }
+        advance(1);
+        return {TokenType::Unknown,
+                std::string_view(reinterpret_cast<const char*>(input_ + start), 1),
+                start_line, start_column, Keyword::UNKNOWN};
+    }
+
+template<typename Policy>
+Token BasicSimdTokenizer<Policy>::scan_identifier_or_keyword(size_t start, uint32_t start_line, uint32_t start_column) {
+        Keyword kw = Keyword::UNKNOWN;
+        size_t dfa_end = start;
+        if constexpr (Policy::lexer == LexerKind::Dfa) {
+            // One table walk yields the ASCII word and its keyword; the loop
+            // below only continues past it for UTF-8 characters
+            DfaWord word = dfa_scan_word(reinterpret_cast<const uint8_t*>(input_ + position_),
+                                         input_size_ - position_);
+            advance(word.length);
+            dfa_end = position_;
+            kw = word.keyword;
+        }
+        
         while (position_ < input_size_) {
             uint8_t ch = static_cast<uint8_t>(input_[position_]);
             if (!((ch >= 'A' && ch <= 'Z') ||
                   (ch >= 'a' && ch <= 'z') ||
                   (ch >= '0' && ch <= '9') ||
                   ch == '_')) {
-                break;
+                size_t length = ch >= 0x80 ? utf8_length_at(position_) : 0;
+                if (length == 0) {
+                    break;
+                }
+                advance(length);
+                continue;
             }
-            ++position_;
-            ++column_;
+            advance(1);
         }
         
         std::string_view value(
@@ -112,28 +244,41 @@ Token SimdTokenizer::scan_identifier_or_keyword(size_t start, uint32_t start_lin
             position_ - start
         );
         
-        // Use generated keyword lookup
-        Keyword kw = find_keyword(value);
+        if constexpr (Policy::lexer == LexerKind::Dfa) {
+            if (position_ != dfa_end || Policy::keywords == KeywordMode::None) {
+                kw = Keyword::UNKNOWN;
+            }
+        } else if constexpr (Policy::keywords != KeywordMode::None) {
+            // Use generated keyword lookup
+            kw = find_keyword(value);
+        }
         TokenType type = (kw != Keyword::UNKNOWN) ? TokenType::Keyword : TokenType::Identifier;
         
         // For even faster SIMD-based keyword matching (optional optimization)
-        if (kw == Keyword::UNKNOWN && value.length() <= 32) {
-            dispatcher_.dispatch([&](auto processor) {
-                return is_keyword_simd(processor, 
-                    input_ + start, 
-                    value.length(), 
-                    kw);
-            });
-            
-            if (kw != Keyword::UNKNOWN) {
-                type = TokenType::Keyword;
+        if constexpr (Policy::keywords == KeywordMode::Full && Policy::lexer == LexerKind::HandWritten) {
+            if (kw == Keyword::UNKNOWN && value.length() <= 32) {
+                dispatcher_.dispatch([&](auto processor) {
+                    return is_keyword_simd(processor, 
+                        input_ + start, 
+                        value.length(), 
+                        kw);
+                });
+                
+                if (kw != Keyword::UNKNOWN) {
+                    type = TokenType::Keyword;
+                }
             }
         }
         
-        return {type, value, start_line, start_column, kw};
+        Token token(type, value, start_line, start_column, kw);
+        if (symbols_ != nullptr && type == TokenType::Identifier) {
+            token.symbol_id = symbols_->intern(value, symbol_hash(value));
+        }
+        return token;
     }
 
-Token SimdTokenizer::scan_number(size_t start, uint32_t start_line, uint32_t start_column) {
+template<typename Policy>
+Token BasicSimdTokenizer<Policy>::scan_number(size_t start, uint32_t start_line, uint32_t start_column) {
         bool has_dot = false;
         bool has_exp = false;
         
@@ -141,22 +286,18 @@ Token SimdTokenizer::scan_number(size_t start, uint32_t start_line, uint32_t sta
             uint8_t ch = static_cast<uint8_t>(input_[position_]);
             
             if (ch >= '0' && ch <= '9') {
-                ++position_;
-                ++column_;
+                advance(1);
             } else if (ch == '.' && !has_dot && !has_exp) {
                 has_dot = true;
-                ++position_;
-                ++column_;
+                advance(1);
             } else if ((ch == 'e' || ch == 'E') && !has_exp) {
                 has_exp = true;
-                ++position_;
-                ++column_;
+                advance(1);
                 
                 if (position_ < input_size_) {
                     ch = static_cast<uint8_t>(input_[position_]);
                     if (ch == '+' || ch == '-') {
-                        ++position_;
-                        ++column_;
+                        advance(1);
                     }
                 }
             } else {
@@ -169,12 +310,21 @@ Token SimdTokenizer::scan_number(size_t start, uint32_t start_line, uint32_t sta
             position_ - start
         );
         
+        // Convert while the digits are still hot in L1
+        if (numeric_out_ != nullptr) {
+            NumericValue parsed = dispatcher_.dispatch([&](auto processor) {
+                return parse_numeric_literal(processor, value);
+            });
+            parsed.token_index = token_index_;
+            numeric_out_->push_back(parsed);
+        }
+        
         return {TokenType::Number, value, start_line, start_column, Keyword::UNKNOWN};
     }
 
-Token SimdTokenizer::scan_string(size_t start, uint32_t start_line, uint32_t start_column, uint8_t quote) {
-        ++position_;
-        ++column_;
+template<typename Policy>
+Token BasicSimdTokenizer<Policy>::scan_string(size_t start, uint32_t start_line, uint32_t start_column, uint8_t quote) {
+        advance(1);
         
         while (position_ < input_size_) {
             uint8_t ch = static_cast<uint8_t>(input_[position_]);
@@ -182,20 +332,15 @@ Token SimdTokenizer::scan_string(size_t start, uint32_t start_line, uint32_t sta
             if (ch == quote) {
                 if (position_ + 1 < input_size_ &&
                     static_cast<uint8_t>(input_[position_ + 1]) == quote) {
-                    position_ += 2;
-                    column_ += 2;
+                    advance(2);
                 } else {
-                    ++position_;
-                    ++column_;
+                    advance(1);
                     break;
                 }
             } else if (ch == '\n') {
-                ++position_;
-                ++line_;
-                column_ = 1;
+                advance_line();
             } else {
-                ++position_;
-                ++column_;
+                advance(1);
             }
         }
         
@@ -207,19 +352,16 @@ Token SimdTokenizer::scan_string(size_t start, uint32_t start_line, uint32_t sta
         return {TokenType::String, value, start_line, start_column, Keyword::UNKNOWN};
     }
 
-Token SimdTokenizer::scan_comment(size_t start, uint32_t start_line, uint32_t start_column) {
-        position_ += 2;
-        column_ += 2;
+template<typename Policy>
+Token BasicSimdTokenizer<Policy>::scan_comment(size_t start, uint32_t start_line, uint32_t start_column) {
+        advance(2);
         
         while (position_ < input_size_) {
             if (static_cast<uint8_t>(input_[position_]) == '\n') {
-                ++position_;
-                ++line_;
-                column_ = 1;
+                advance_line();
                 break;
             }
-            ++position_;
-            ++column_;
+            advance(1);
         }
         
         std::string_view value(
@@ -230,23 +372,19 @@ Token SimdTokenizer::scan_comment(size_t start, uint32_t start_line, uint32_t st
         return {TokenType::Comment, value, start_line, start_column, Keyword::UNKNOWN};
     }
 
-Token SimdTokenizer::scan_block_comment(size_t start, uint32_t start_line, uint32_t start_column) {
-        position_ += 2;
-        column_ += 2;
+template<typename Policy>
+Token BasicSimdTokenizer<Policy>::scan_block_comment(size_t start, uint32_t start_line, uint32_t start_column) {
+        advance(2);
         
         while (position_ + 1 < input_size_) {
             if (static_cast<uint8_t>(input_[position_]) == '*' &&
                 static_cast<uint8_t>(input_[position_ + 1]) == '/') {
-                position_ += 2;
-                column_ += 2;
+                advance(2);
                 break;
             } else if (static_cast<uint8_t>(input_[position_]) == '\n') {
-                ++position_;
-                ++line_;
-                column_ = 1;
+                advance_line();
             } else {
-                ++position_;
-                ++column_;
+                advance(1);
             }
         }
         
@@ -258,44 +396,65 @@ Token SimdTokenizer::scan_block_comment(size_t start, uint32_t start_line, uint3
         return {TokenType::Comment, value, start_line, start_column, Keyword::UNKNOWN};
     }
 
-Token SimdTokenizer::scan_operator_or_delimiter(size_t start, uint32_t start_line, uint32_t start_column) {
-        uint8_t ch = static_cast<uint8_t>(input_[position_]);
-        ++position_;
-        ++column_;
-        
-        TokenType type = TokenType::Operator;
+template<typename Policy>
+Token BasicSimdTokenizer<Policy>::scan_operator_or_delimiter(size_t start, uint32_t start_line, uint32_t start_column) {
+        // Longest match via the pair table; the kind rides along in `reserved`
+        OperatorMatch match = match_operator(
+            reinterpret_cast<const uint8_t*>(input_ + position_), input_size_ - position_);
+        advance(match.length);
         
-        if (ch == '(' || ch == ')' || ch == '[' || ch == ']' ||
-            ch == '{' || ch == '}' || ch == ',' || ch == ';') {
-            type = TokenType::Delimiter;
-        }
-        
-        if (position_ < input_size_) {
-            uint8_t next = static_cast<uint8_t>(input_[position_]);
-            
-            if ((ch == '<' && (next == '=' || next == '>')) ||
-                (ch == '>' && next == '=') ||
-                (ch == '!' && next == '=') ||
-                (ch == '=' && next == '=') ||  // Add support for ==
-                (ch == '|' && next == '|') ||
-                (ch == '&' && next == '&') ||
-                (ch == ':' && next == ':') ||
-                (ch == '<' && next == '<') ||
-                (ch == '>' && next == '>')) {
-                ++position_;
-                ++column_;
-            }
-        }
+        TokenType type = is_delimiter_kind(match.kind) ? TokenType::Delimiter : TokenType::Operator;
         
         std::string_view value(
             reinterpret_cast<const char*>(input_ + start),
             position_ - start
         );
         
-        return {type, value, start_line, start_column, Keyword::UNKNOWN};
+        Token token(type, value, start_line, start_column, Keyword::UNKNOWN);
+        token.reserved = static_cast<uint8_t>(match.kind);
+        return token;
     }
 
-void SimdTokenizer::update_position(size_t count) {
+// Validates the next chunk of input in the same pass as whitespace
+// skipping. Chunks end on a sequence boundary so each one validates
+// standalone; after the first error later input is checked per sequence.
+template<typename Policy>
+void BasicSimdTokenizer<Policy>::validate_utf8_ahead() {
+        constexpr size_t UTF8_CHUNK = 4096;
+        const auto* data = reinterpret_cast<const uint8_t*>(input_);
+        
+        size_t begin = utf8_checked_;
+        size_t end = std::min(input_size_, begin + UTF8_CHUNK);
+        for (int i = 0; i < 3 && end < input_size_ && end > begin + 1 && (data[end] & 0xC0) == 0x80; ++i) {
+            --end;
+        }
+        
+        size_t invalid = dispatcher_.dispatch([&](auto processor) {
+            return validate_utf8(processor, data + begin, end - begin);
+        });
+        if (invalid < end - begin) {
+            utf8_error_ = begin + invalid;
+            end = input_size_;
+        }
+        utf8_checked_ = end;
+    }
+
+template<typename Policy>
+size_t BasicSimdTokenizer<Policy>::utf8_length_at(size_t pos) const noexcept {
+        const auto* data = reinterpret_cast<const uint8_t*>(input_);
+        uint8_t lead = data[pos];
+        if (pos < utf8_checked_ && pos < utf8_error_ && lead >= 0xC0) LIKELY {
+            return utf8_lead_length(lead);
+        }
+        return utf8_sequence_length(data + pos, input_size_ - pos);
+    }
+
+template<typename Policy>
+void BasicSimdTokenizer<Policy>::update_position(size_t count) {
+        if constexpr (!Policy::track_positions) {
+            position_ += count;
+            return;
+        }
         for (size_t i = 0; i < count; ++i) {
             if (static_cast<uint8_t>(input_[position_]) == '\n') {
                 ++line_;
@@ -307,4 +466,256 @@ void SimdTokenizer::update_position(size_t count) {
         }
 }
 
+// Consumes a comment at the cursor; used when comments are not emitted
+template<typename Policy>
+bool BasicSimdTokenizer<Policy>::skip_comment() {
+        if (position_ + 1 >= input_size_) {
+            return false;
+        }
+        uint8_t first = static_cast<uint8_t>(input_[position_]);
+        uint8_t second = static_cast<uint8_t>(input_[position_ + 1]);
+        if (first == '-' && second == '-') {
+            (void)scan_comment(position_, 0, 0);
+            return true;
+        }
+        if (first == '/' && second == '*') {
+            (void)scan_block_comment(position_, 0, 0);
+            return true;
+        }
+        return false;
+    }
+
+// '(' or the word ON or DO at `pos`: what follows the CONFLICT of ON CONFLICT
+template<typename Policy>
+bool BasicSimdTokenizer<Policy>::starts_conflict_action(size_t pos) const noexcept {
+        if (pos < input_size_ && input_[pos] == std::byte{'('}) {
+            return true;
+        }
+        if (pos + 2 > input_size_) {
+            return false;
+        }
+        uint8_t first = static_cast<uint8_t>(input_[pos]) & 0xDF;
+        uint8_t second = static_cast<uint8_t>(input_[pos + 1]) & 0xDF;
+        bool word = (first == 'O' && second == 'N') || (first == 'D' && second == 'O');
+        if (!word || pos + 2 == input_size_) {
+            return word;
+        }
+        uint8_t after = static_cast<uint8_t>(input_[pos + 2]);
+        return !((after >= 'A' && after <= 'Z') || (after >= 'a' && after <= 'z') ||
+                 (after >= '0' && after <= '9') || after == '_' || after >= 0x80);
+    }
+
+// Extends a keyword token over the longest COMPOUND_KEYWORDS sequence it
+// starts. Looks ahead word by word, skipping whitespace and comments, and
+// rewinds to the end of the last complete match.
+template<typename Policy>
+void BasicSimdTokenizer<Policy>::fuse_compound_keyword(Token& token) {
+        if (!keyword_has(token.keyword_id, KeywordAttr::COMPOUND_HEAD)) {
+            return;
+        }
+        
+        Keyword parts[COMPOUND_KEYWORD_MAX_PARTS] = {token.keyword_id};
+        Keyword fused = Keyword::UNKNOWN;
+        size_t end = position_;
+        uint32_t end_line = line_;
+        uint32_t end_column = column_;
+        
+        for (size_t count = 1; count < COMPOUND_KEYWORD_MAX_PARTS; ++count) {
+            for (;;) {
+                size_t skip = dispatcher_.dispatch([this](auto processor) {
+                    return processor.skip_whitespace(input_ + position_, input_size_ - position_);
+                });
+                update_position(skip);
+                if (!skip_comment()) {
+                    break;
+                }
+            }
+            
+            size_t word_start = position_;
+            while (position_ < input_size_) {
+                uint8_t ch = static_cast<uint8_t>(input_[position_]);
+                if (!((ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') ||
+                      (ch >= '0' && ch <= '9') || ch == '_')) {
+                    break;
+                }
+                advance(1);
+            }
+            // A UTF-8 character would continue the word as an identifier
+            if (position_ < input_size_ && static_cast<uint8_t>(input_[position_]) >= 0x80 &&
+                utf8_length_at(position_) > 0) {
+                break;
+            }
+            parts[count] = find_keyword(std::string_view(
+                reinterpret_cast<const char*>(input_ + word_start), position_ - word_start));
+            if (parts[count] == Keyword::UNKNOWN) {
+                break;
+            }
+            // A word before '.' qualifies a name (ON conflict.id), not a keyword
+            size_t next = position_ + ScalarProcessor{}.skip_whitespace(input_ + position_, input_size_ - position_);
+            if (next < input_size_ && input_[next] == std::byte{'.'}) {
+                break;
+            }
+            
+            CompoundMatch match = match_compound_keyword(parts, count + 1);
+            // CONFLICT is not reserved: JOIN conflict ON conflict = ... names
+            // a table. Only ON CONFLICT ( / ON CONSTRAINT / DO is the clause.
+            if (match.keyword == Keyword::ON_CONFLICT && !starts_conflict_action(next)) {
+                match.keyword = Keyword::UNKNOWN;
+            }
+            if (match.keyword != Keyword::UNKNOWN) {
+                fused = match.keyword;
+                end = position_;
+                end_line = line_;
+                end_column = column_;
+            }
+            if (!match.extensible) {
+                break;
+            }
+        }
+        
+        position_ = end;
+        line_ = end_line;
+        column_ = end_column;
+        if (fused != Keyword::UNKNOWN) {
+            token.keyword_id = fused;
+            token.value = std::string_view(token.value.data(),
+                                           reinterpret_cast<const char*>(input_ + end) - token.value.data());
+        }
+    }
+
+// Emits the literal tuples at the cursor as one LiteralList token
+template<typename Policy>
+bool BasicSimdTokenizer<Policy>::scan_literal_list(Token& token) {
+        if (static_cast<uint8_t>(input_[position_]) != '(') {
+            return false;
+        }
+        // VALUES takes any number of rows; IN takes one tuple
+        size_t max_rows = literal_rows_after_ == Keyword::VALUES ? SIZE_MAX : 1;
+        LiteralRowsMatch match = scan_literal_rows(input_, input_size_, position_, max_rows, *literal_rows_);
+        if (match.end == position_) {
+            return false;
+        }
+        
+        size_t start = position_;
+        token = Token(TokenType::LiteralList,
+                      std::string_view(reinterpret_cast<const char*>(input_ + start), match.end - start),
+                      Policy::track_positions ? line_ : 0, Policy::track_positions ? column_ : 0);
+        token.symbol_id = static_cast<uint32_t>(literal_rows_->lists.size());     // Index + 1; 0 = none
+        
+        position_ = match.end;
+        if constexpr (Policy::track_positions) {
+            if (match.newlines > 0) {
+                line_ += static_cast<uint32_t>(match.newlines);
+                column_ = static_cast<uint32_t>(match.end - match.last_newline);
+            } else {
+                column_ += static_cast<uint32_t>(match.end - start);
+            }
+        }
+        return true;
+    }
+
+// Emits the data lines after COPY ... FROM stdin; as one CopyData token,
+// leaving the cursor on the "\." line
+template<typename Policy>
+bool BasicSimdTokenizer<Policy>::scan_copy_data(Token& token) {
+        size_t begin = copy_data_begin(input_, input_size_, position_ - 1);
+        if (begin == SIZE_MAX) {
+            return false;
+        }
+        CopyDataMatch match = find_copy_data_end(input_, input_size_, begin);
+        
+        if constexpr (Policy::track_positions) {
+            ++line_;
+            column_ = 1;
+        }
+        token = Token(TokenType::CopyData,
+                      std::string_view(reinterpret_cast<const char*>(input_ + begin), match.end - begin),
+                      Policy::track_positions ? line_ : 0, Policy::track_positions ? column_ : 0);
+        
+        position_ = match.end;
+        statement_begin_ = match.end;
+        if constexpr (Policy::track_positions) {
+            line_ += static_cast<uint32_t>(match.newlines);
+            column_ = 1;
+            if (match.end == input_size_ && match.end > begin && input_[match.end - 1] != std::byte{'\n'}) {
+                // Unterminated data: the cursor is at the end of its last line
+                size_t line_start = match.end;
+                while (line_start > begin && input_[line_start - 1] != std::byte{'\n'}) --line_start;
+                column_ = static_cast<uint32_t>(match.end - line_start + 1);
+            }
+        }
+        return true;
+    }
+
+// Emits the dollar quote at the cursor as one DollarString token
+template<typename Policy>
+bool BasicSimdTokenizer<Policy>::scan_dollar_quote(Token& token) {
+        size_t start = position_;
+        size_t tag = dollar_quote_open(input_, input_size_, start);
+        if (tag == 0) {
+            return false;
+        }
+        const auto* text = reinterpret_cast<const char*>(input_);
+        DollarQuoteMatch match = find_dollar_quote_end(input_, input_size_, start + tag,
+                                                       std::string_view(text + start, tag));
+        
+        token = Token(TokenType::DollarString, std::string_view(text + start, match.end - start),
+                      Policy::track_positions ? line_ : 0, Policy::track_positions ? column_ : 0);
+        position_ = match.end;
+        if constexpr (Policy::track_positions) {
+            if (match.newlines > 0) {
+                line_ += static_cast<uint32_t>(match.newlines);
+                column_ = static_cast<uint32_t>(match.end - match.last_newline);
+            } else {
+                column_ += static_cast<uint32_t>(match.end - start);
+            }
+        }
+        return true;
+    }
+
+// A psql meta-command: '\' up to the end of its line
+template<typename Policy>
+Token BasicSimdTokenizer<Policy>::scan_meta_command() {
+        size_t start = position_;
+        Token token(TokenType::MetaCommand, "", Policy::track_positions ? line_ : 0,
+                    Policy::track_positions ? column_ : 0);
+        advance(meta_command_end(input_, input_size_, start) - start);
+        token.value = std::string_view(reinterpret_cast<const char*>(input_ + start), position_ - start);
+        return token;
+    }
+
+template<typename Policy>
+void BasicSimdTokenizer<Policy>::advance(size_t count) noexcept {
+        position_ += count;
+        if constexpr (Policy::track_positions) {
+            column_ += static_cast<uint32_t>(count);
+        }
+    }
+
+// Steps over a '\n'
+template<typename Policy>
+void BasicSimdTokenizer<Policy>::advance_line() noexcept {
+        ++position_;
+        if constexpr (Policy::track_positions) {
+            ++line_;
+            column_ = 1;
+        }
+    }
+
+// Every TokenizerPolicy combination
+#define DB25_INSTANTIATE_TOKENIZERS(comments, positions)                                                                  \
+    template class BasicSimdTokenizer<TokenizerPolicy<comments, positions, KeywordMode::Full, LexerKind::HandWritten>>;   \
+    template class BasicSimdTokenizer<TokenizerPolicy<comments, positions, KeywordMode::Lookup, LexerKind::HandWritten>>; \
+    template class BasicSimdTokenizer<TokenizerPolicy<comments, positions, KeywordMode::None, LexerKind::HandWritten>>;   \
+    template class BasicSimdTokenizer<TokenizerPolicy<comments, positions, KeywordMode::Full, LexerKind::Dfa>>;           \
+    template class BasicSimdTokenizer<TokenizerPolicy<comments, positions, KeywordMode::Lookup, LexerKind::Dfa>>;         \
+    template class BasicSimdTokenizer<TokenizerPolicy<comments, positions, KeywordMode::None, LexerKind::Dfa>>;
+
+DB25_INSTANTIATE_TOKENIZERS(true, true)
+DB25_INSTANTIATE_TOKENIZERS(true, false)
+DB25_INSTANTIATE_TOKENIZERS(false, true)
+DB25_INSTANTIATE_TOKENIZERS(false, false)
+
+#undef DB25_INSTANTIATE_TOKENIZERS
+
 }  // namespace db25
\ No newline at end of file
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "statement_classifier.hpp"
+
+namespace db25 {
+
+namespace {
+
+// One-token lookahead over a lazily driven tokenizer
+class TokenCursor {
+private:
+    RouterTokenizer tokenizer_;
+    const char* input_;
+    Token current_;
+    size_t scanned_ = 0;
+
+public:
+    TokenCursor(const std::byte* input, size_t size)
+        : tokenizer_(input, size), input_(reinterpret_cast<const char*>(input)) {
+        advance();
+    }
+
+    [[nodiscard]] const Token& peek() const noexcept { return current_; }
+    [[nodiscard]] size_t scanned() const noexcept { return scanned_; }
+    // Offset of the current token; not at EndOfFile
+    [[nodiscard]] size_t position() const noexcept { return static_cast<size_t>(current_.value.data() - input_); }
+
+    [[nodiscard]] bool at_end() const noexcept {
+        return current_.type == TokenType::EndOfFile || current_.operator_kind() == OperatorKind::Semicolon;
+    }
+
+    void advance() {
+        if (tokenizer_.next(current_)) {
+            scanned_ = static_cast<size_t>(current_.value.data() + current_.value.size() - input_);
+        } else {
+            current_ = Token(TokenType::EndOfFile, {}, 0, 0);
+        }
+    }
+
+    bool accept(Keyword keyword) {
+        if (current_.type == TokenType::Keyword && current_.keyword_id == keyword) {
+            advance();
+            return true;
+        }
+        return false;
+    }
+
+    bool accept(OperatorKind kind) {
+        if (current_.operator_kind() == kind) {
+            advance();
+            return true;
+        }
+        return false;
+    }
+
+    // Consumes a balanced group; the cursor is on its opening '('
+    void skip_group() {
+        size_t depth = 0;
+        do {
+            OperatorKind kind = current_.operator_kind();
+            if (kind == OperatorKind::LeftParen) {
+                ++depth;
+            } else if (kind == OperatorKind::RightParen) {
+                --depth;
+            }
+            advance();
+        } while (depth > 0 && current_.type != TokenType::EndOfFile);
+    }
+};
+
+// Identifiers, quoted identifiers and non-reserved keywords that do not
+// start a clause or act as an operator name tables
+bool is_name(const Token& token) noexcept {
+    constexpr uint16_t NOT_A_NAME = KeywordAttr::RESERVED | KeywordAttr::CLAUSE_START |
+                                    KeywordAttr::STATEMENT_START | KeywordAttr::JOIN | KeywordAttr::OPERATOR;
+    switch (token.type) {
+        case TokenType::Identifier:
+            return true;
+        case TokenType::String:
+            return token.value.front() == '"';
+        case TokenType::Keyword:
+            return !keyword_has(token.keyword_id, NOT_A_NAME);
+        default:
+            return false;
+    }
+}
+
+// name { '.' name } as one span
+std::string_view take_qualified_name(TokenCursor& cursor) {
+    if (!is_name(cursor.peek())) {
+        return {};
+    }
+    const char* begin = cursor.peek().value.data();
+    const char* end = begin + cursor.peek().value.size();
+    cursor.advance();
+    while (cursor.peek().operator_kind() == OperatorKind::Dot) {
+        cursor.advance();
+        if (!is_name(cursor.peek())) {
+            break;
+        }
+        end = cursor.peek().value.data() + cursor.peek().value.size();
+        cursor.advance();
+    }
+    return {begin, static_cast<size_t>(end - begin)};
+}
+
+bool is_writing_keyword(const Token& token) noexcept {
+    return token.type == TokenType::Keyword &&
+           (token.keyword_id == Keyword::INSERT || token.keyword_id == Keyword::UPDATE ||
+            token.keyword_id == Keyword::DELETE);
+}
+
+// name [(columns)] AS [NOT] [MATERIALIZED] ( body ) { , ... }
+void skip_common_table_expressions(TokenCursor& cursor, StatementClass& out) {
+    cursor.accept(Keyword::RECURSIVE);
+    do {
+        (void)take_qualified_name(cursor);
+        if (cursor.peek().operator_kind() == OperatorKind::LeftParen) {
+            cursor.skip_group();
+        }
+        if (!cursor.accept(Keyword::AS)) {
+            return;
+        }
+        while (!cursor.at_end() && cursor.peek().operator_kind() != OperatorKind::LeftParen) {
+            cursor.advance();
+        }
+        if (cursor.at_end()) {
+            return;
+        }
+        // Peek at the body's first keyword before skipping it
+        cursor.advance();
+        out.writes |= is_writing_keyword(cursor.peek());
+        size_t depth = 1;
+        while (depth > 0 && cursor.peek().type != TokenType::EndOfFile) {
+            OperatorKind kind = cursor.peek().operator_kind();
+            depth += kind == OperatorKind::LeftParen;
+            depth -= kind == OperatorKind::RightParen;
+            cursor.advance();
+        }
+    } while (cursor.accept(OperatorKind::Comma));
+}
+
+StatementKind kind_of(Keyword keyword) noexcept {
+    switch (keyword) {
+        case Keyword::SELECT:
+        case Keyword::VALUES:
+            return StatementKind::Select;
+        case Keyword::INSERT:
+            return StatementKind::Insert;
+        case Keyword::UPDATE:
+            return StatementKind::Update;
+        case Keyword::DELETE:
+            return StatementKind::Delete;
+        case Keyword::CREATE:
+        case Keyword::ALTER:
+        case Keyword::DROP:
+            return StatementKind::Ddl;
+        case Keyword::BEGIN:
+        case Keyword::START:
+        case Keyword::COMMIT:
+        case Keyword::END:
+        case Keyword::ROLLBACK:
+        case Keyword::SAVEPOINT:
+        case Keyword::RELEASE:
+            return StatementKind::Transaction;
+        case Keyword::EXPLAIN:
+        case Keyword::ANALYZE:
+        case Keyword::VACUUM:
+        case Keyword::REINDEX:
+        case Keyword::PRAGMA:
+        case Keyword::ATTACH:
+        case Keyword::DETACH:
+            return StatementKind::Utility;
+        default:
+            return StatementKind::Unknown;
+    }
+}
+
+bool is_ddl_object(Keyword keyword) noexcept {
+    switch (keyword) {
+        case Keyword::TABLE:
+        case Keyword::VIEW:
+        case Keyword::INDEX:
+        case Keyword::SEQUENCE:
+        case Keyword::TRIGGER:
+        case Keyword::SCHEMA:
+        case Keyword::DATABASE:
+        case Keyword::TYPE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// UPDATE, NO [KEY UPDATE], SHARE or KEY [SHARE] after FOR: a row lock
+bool is_lock_strength(const Token& token) noexcept {
+    if (token.type == TokenType::Keyword) {
+        return token.keyword_id == Keyword::UPDATE || token.keyword_id == Keyword::NO ||
+               token.keyword_id == Keyword::KEY;
+    }
+    constexpr std::string_view SHARE = "SHARE";
+    if (token.type != TokenType::Identifier || token.value.size() != SHARE.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < SHARE.size(); ++i) {
+        if ((static_cast<uint8_t>(token.value[i]) & 0xDF) != static_cast<uint8_t>(SHARE[i])) return false;
+    }
+    return true;
+}
+
+constexpr bool is_word_byte(uint8_t c) noexcept {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c >= 0x80;
+}
+
+// Byte pre-check: a FOR keyword needs the word "for" in some case. Strings
+// and comments only cause a false positive and a lexed tail.
+bool may_contain_for(const char* text, size_t size) noexcept {
+    const auto* p = reinterpret_cast<const uint8_t*>(text);
+    for (size_t i = 0; i + 3 <= size; ++i) {
+        if ((p[i] | 0x20) == 'f' && (p[i + 1] | 0x20) == 'o' && (p[i + 2] | 0x20) == 'r' &&
+            (i == 0 || !is_word_byte(p[i - 1])) && (i + 3 == size || !is_word_byte(p[i + 3]))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Scans forward to `keyword` and takes the name after it
+std::string_view target_after(TokenCursor& cursor, Keyword keyword, StatementClass& out) {
+    while (!cursor.at_end()) {
+        if (keyword == Keyword::FROM && cursor.accept(Keyword::FOR)) {
+            out.writes |= is_lock_strength(cursor.peek());   // Locking clause before any FROM
+            continue;
+        }
+        const Token& token = cursor.peek();
+        if (token.type == TokenType::Keyword && token.keyword_id == Keyword::INTO &&
+            keyword == Keyword::FROM) {
+            out.writes = true;      // SELECT ... INTO new_table
+        }
+        bool found = token.type == TokenType::Keyword && token.keyword_id == keyword;
+        cursor.advance();
+        if (found) {
+            cursor.accept(Keyword::ONLY);
+            std::string_view name = take_qualified_name(cursor);
+            if (!name.empty()) {
+                return name;
+            }
+        }
+    }
+    return {};
+}
+
+}  // namespace
+
+std::string_view statement_kind_name(StatementKind kind) noexcept {
+    switch (kind) {
+        case StatementKind::Select:      return "SELECT";
+        case StatementKind::Insert:      return "INSERT";
+        case StatementKind::Update:      return "UPDATE";
+        case StatementKind::Delete:      return "DELETE";
+        case StatementKind::Ddl:         return "DDL";
+        case StatementKind::Transaction: return "TRANSACTION";
+        case StatementKind::Utility:     return "UTILITY";
+        default:                         return "UNKNOWN";
+    }
+}
+
+StatementClass classify_statement(const std::byte* input, size_t size) {
+    StatementClass out;
+    TokenCursor cursor(input, size);
+
+    while (cursor.accept(OperatorKind::LeftParen)) {
+    }
+    if (cursor.accept(Keyword::WITH)) {
+        skip_common_table_expressions(cursor, out);
+    }
+
+    const Token& first = cursor.peek();
+    out.keyword = first.type == TokenType::Keyword ? first.keyword_id : Keyword::UNKNOWN;
+    out.kind = kind_of(out.keyword);
+    if (out.kind != StatementKind::Unknown) {
+        cursor.advance();
+    }
+
+    switch (out.kind) {
+        case StatementKind::Select:
+            out.target = target_after(cursor, Keyword::FROM, out);
+            // Row locks follow FROM, possibly in a subquery; lex the rest of
+            // the statement only if it can contain them
+            if (!out.writes && !cursor.at_end() &&
+                may_contain_for(reinterpret_cast<const char*>(input) + cursor.position(), size - cursor.position())) {
+                while (!cursor.at_end() && !out.writes) {
+                    if (cursor.accept(Keyword::FOR)) {
+                        out.writes = is_lock_strength(cursor.peek());
+                    } else {
+                        cursor.advance();
+                    }
+                }
+            }
+            break;
+        case StatementKind::Insert:
+            out.writes = true;
+            out.target = target_after(cursor, Keyword::INTO, out);
+            break;
+        case StatementKind::Update:
+            out.writes = true;
+            // UPDATE [OR conflict-action] [ONLY] name
+            if (cursor.accept(Keyword::OR)) {
+                cursor.advance();
+            }
+            cursor.accept(Keyword::ONLY);
+            out.target = take_qualified_name(cursor);
+            break;
+        case StatementKind::Delete:
+            out.writes = true;
+            out.target = target_after(cursor, Keyword::FROM, out);
+            break;
+        case StatementKind::Ddl:
+            out.writes = true;
+            // CREATE [OR REPLACE] [TEMP | UNIQUE | ...] object [IF [NOT] EXISTS] name
+            while (!cursor.at_end() && cursor.peek().type == TokenType::Keyword) {
+                Keyword keyword = cursor.peek().keyword_id;
+                cursor.advance();
+                if (is_ddl_object(keyword)) {
+                    out.object = keyword;
+                    if (cursor.accept(Keyword::IF)) {
+                        cursor.accept(Keyword::NOT);
+                        cursor.accept(Keyword::EXISTS);
+                    }
+                    out.target = take_qualified_name(cursor);
+                    break;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+
+    out.scanned = cursor.scanned();
+    return out;
+}
+
+}  // namespace db25
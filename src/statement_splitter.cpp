@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "statement_splitter.hpp"
+#include "dollar_quote.hpp"
+#include "simd_block_scan.hpp"
+#include "optimization_hints.hpp"
+#include "psql_script.hpp"
+#include "utf8.hpp"
+#include <bit>
+
+namespace db25 {
+
+namespace {
+
+enum class SplitState : uint8_t {
+    Normal,
+    SingleQuote,
+    DoubleQuote,
+    LineComment,
+    BlockComment
+};
+
+// Order of the bytes classified per block
+enum Mask : size_t { SQUOTE, DQUOTE, DASH, SLASH, STAR, NEWLINE, SEMICOLON, BACKSLASH, DOLLAR };
+constexpr std::array<uint8_t, 9> SPLIT_CHARS = {'\'', '"', '-', '/', '*', '\n', ';', '\\', '$'};
+
+// Bytes of identifiers and numbers, plus the '.' between number parts
+constexpr bool is_word_byte(uint8_t c) noexcept {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+           c == '_' || c == '.' || c >= 0x80;
+}
+
+// True if the tokenizer consumes the '-' at `i` as an exponent sign ("1e-"),
+// in which case a following '-' does not start a comment. Re-lexes the words
+// before `i` from the nearest byte that must start a token.
+bool is_exponent_sign(const uint8_t* data, size_t size, size_t i) noexcept {
+    if (i < 2 || (data[i - 1] | 0x20) != 'e') {
+        return false;
+    }
+    size_t start = i - 1;
+    while (start > 0) {
+        if (is_word_byte(data[start - 1])) {
+            --start;
+        } else if ((data[start - 1] == '-' || data[start - 1] == '+') && start >= 2 &&
+                   (data[start - 2] | 0x20) == 'e') {
+            start -= 2;   // Possibly an earlier exponent sign
+        } else {
+            break;
+        }
+    }
+    
+    // Same rules as SimdTokenizer::scan_number / scan_identifier_or_keyword
+    size_t p = start;
+    while (p < i) {
+        uint8_t ch = data[p];
+        if (ch >= '0' && ch <= '9') {
+            bool has_dot = false;
+            bool has_exp = false;
+            while (p < size) {
+                ch = data[p];
+                if (ch >= '0' && ch <= '9') {
+                    ++p;
+                } else if (ch == '.' && !has_dot && !has_exp) {
+                    has_dot = true;
+                    ++p;
+                } else if ((ch | 0x20) == 'e' && !has_exp) {
+                    has_exp = true;
+                    ++p;
+                    if (p < size && (data[p] == '+' || data[p] == '-')) ++p;
+                } else {
+                    break;
+                }
+            }
+            if (p > i) {
+                return true;
+            }
+        } else if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || ch == '_' ||
+                   (ch >= 0x80 && utf8_sequence_length(data + p, size - p) > 0)) {
+            while (p < size) {
+                ch = data[p];
+                if ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '_') {
+                    ++p;
+                } else if (size_t length = ch >= 0x80 ? utf8_sequence_length(data + p, size - p) : 0) {
+                    p += length;
+                } else {
+                    break;
+                }
+            }
+        } else {
+            ++p;   // '.', a sign or an invalid UTF-8 byte: a one-byte token
+        }
+    }
+    return false;
+}
+
+template<typename Processor>
+void find_boundaries_impl(Processor processor, const uint8_t* data, size_t size, bool psql_script,
+                          bool dollar_quotes, std::vector<size_t>& out) {
+    SplitState state = SplitState::Normal;
+    size_t comment_start = 0;
+    size_t statement_begin = 0;
+    size_t pos = 0;   // Next byte the state machine has not consumed yet
+    uint8_t scratch[SCAN_BLOCK_SIZE];
+    const auto* input = reinterpret_cast<const std::byte*>(data);
+    
+    // Skipping a meta-command or COPY data block restarts at the block holding `pos`
+    size_t block = 0;
+    while (block < size) {
+        const auto masks = match_block(processor, load_scan_block(data, size, block, scratch), SPLIT_CHARS);
+        const uint64_t normal = masks[SQUOTE] | masks[DQUOTE] | masks[DASH] | masks[SLASH] | masks[SEMICOLON] |
+                                (psql_script ? masks[BACKSLASH] : 0) | (dollar_quotes ? masks[DOLLAR] : 0);
+        bool skipped = false;
+        
+        while (pos < block + SCAN_BLOCK_SIZE) {
+            uint64_t candidates = 0;
+            switch (state) {
+                case SplitState::Normal:       candidates = normal; break;
+                case SplitState::SingleQuote:  candidates = masks[SQUOTE]; break;
+                case SplitState::DoubleQuote:  candidates = masks[DQUOTE]; break;
+                case SplitState::LineComment:  candidates = masks[NEWLINE]; break;
+                case SplitState::BlockComment: candidates = masks[STAR]; break;
+            }
+            if (pos > block) {
+                candidates &= ~uint64_t(0) << (pos - block);
+            }
+            if (candidates == 0) {
+                pos = block + SCAN_BLOCK_SIZE;
+                break;
+            }
+            
+            size_t i = block + std::countr_zero(candidates);
+            uint8_t ch = data[i];
+            uint8_t next = i + 1 < size ? data[i + 1] : 0;
+            pos = i + 1;
+            
+            switch (state) {
+                case SplitState::Normal:
+                    if (ch == ';') {
+                        out.push_back(i);
+                        if (psql_script) {
+                            std::string_view statement(reinterpret_cast<const char*>(data) + statement_begin,
+                                                       i - statement_begin);
+                            size_t begin = is_copy_from_stdin(statement) ? copy_data_begin(input, size, i) : SIZE_MAX;
+                            statement_begin = i + 1;
+                            if (begin != SIZE_MAX) {
+                                // The statement runs through its data and "\." line
+                                out.pop_back();
+                                pos = find_copy_data_end(input, size, begin).end;
+                                skipped = true;
+                            }
+                        }
+                    } else if (ch == '\\') {
+                        // psql meta-command: ends its statement at the end of the line
+                        pos = meta_command_end(input, size, i);
+                        out.push_back(pos - 1);
+                        statement_begin = pos;
+                        skipped = true;
+                    } else if (ch == '$') {
+                        size_t tag = dollar_quote_open(input, size, i);
+                        if (tag != 0) {
+                            std::string_view open(reinterpret_cast<const char*>(data) + i, tag);
+                            pos = find_dollar_quote_end(input, size, i + tag, open).end;
+                            skipped = true;
+                        }
+                    } else if (ch == '\'') {
+                        state = SplitState::SingleQuote;
+                    } else if (ch == '"') {
+                        state = SplitState::DoubleQuote;
+                    } else if (ch == '-' && next == '-' && !is_exponent_sign(data, size, i)) {
+                        state = SplitState::LineComment;
+                        pos = i + 2;
+                    } else if (ch == '/' && next == '*') {
+                        state = SplitState::BlockComment;
+                        comment_start = i;
+                        pos = i + 2;
+                    }
+                    break;
+                    
+                case SplitState::SingleQuote:
+                case SplitState::DoubleQuote:
+                    if (next == ch) {
+                        pos = i + 2;   // Doubled quote is an escaped quote
+                    } else {
+                        state = SplitState::Normal;
+                    }
+                    break;
+                    
+                case SplitState::LineComment:
+                    state = SplitState::Normal;
+                    break;
+                    
+                case SplitState::BlockComment:
+                    if (next == '/') {
+                        state = SplitState::Normal;
+                        pos = i + 2;
+                    }
+                    break;
+            }
+            if (skipped) UNLIKELY {
+                break;
+            }
+        }
+        block = skipped ? pos - pos % SCAN_BLOCK_SIZE : block + SCAN_BLOCK_SIZE;
+    }
+    
+    // The tokenizer ends an unterminated block comment one byte early and
+    // lexes the final byte separately, so a trailing ';' (or meta-command
+    // '\') still splits.
+    if (state == SplitState::BlockComment && comment_start + 3 <= size &&
+        (data[size - 1] == ';' || (psql_script && data[size - 1] == '\\'))) UNLIKELY {
+        out.push_back(size - 1);
+    }
+}
+
+}  // namespace
+
+std::vector<size_t> StatementSplitter::find_boundaries(const std::byte* input, size_t size) const {
+    std::vector<size_t> boundaries;
+    const auto* data = reinterpret_cast<const uint8_t*>(input);
+    dispatcher_.dispatch([&](auto processor) {
+        find_boundaries_impl(processor, data, size, psql_script_, dollar_quotes_, boundaries);
+        return 0;
+    });
+    return boundaries;
+}
+
+std::vector<StatementSpan> StatementSplitter::split(const std::byte* input, size_t size) const {
+    const auto* data = reinterpret_cast<const uint8_t*>(input);
+    auto boundaries = find_boundaries(input, size);
+    
+    auto skip_whitespace = [&](size_t pos) {
+        while (pos < size && (data[pos] == ' ' || data[pos] == '\t' ||
+                              data[pos] == '\n' || data[pos] == '\r')) {
+            ++pos;
+        }
+        return pos;
+    };
+    
+    std::vector<StatementSpan> spans;
+    spans.reserve(boundaries.size() + 1);
+    size_t begin = 0;
+    for (size_t boundary : boundaries) {
+        spans.push_back({skip_whitespace(begin), boundary + 1});
+        begin = boundary + 1;
+    }
+    
+    begin = skip_whitespace(begin);
+    if (begin < size) {
+        spans.push_back({begin, size});
+    }
+    return spans;
+}
+
+}  // namespace db25
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "symbol_table.hpp"
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+namespace db25 {
+
+namespace {
+
+constexpr size_t INITIAL_SLOTS = 64;
+constexpr size_t INITIAL_CHUNK = 4096;
+
+}  // namespace
+
+SymbolTable::SymbolTable() {
+    for (Shard& shard : shards_) {
+        shard.slots.resize(INITIAL_SLOTS);
+    }
+}
+
+SymbolTable::~SymbolTable() {
+    for (auto& segment : names_) {
+        delete[] segment.load(std::memory_order_relaxed);
+    }
+}
+
+const SymbolTable::Entry* SymbolTable::Shard::lookup(std::string_view name, uint64_t hash) const noexcept {
+    const size_t mask = slots.size() - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        const Entry& entry = slots[i];
+        if (entry.id == NO_SYMBOL) {
+            return nullptr;
+        }
+        if (entry.hash == hash && symbol_equals({entry.text, entry.length}, name)) {
+            return &entry;
+        }
+    }
+}
+
+const char* SymbolTable::Shard::store(std::string_view name) {
+    if (chunks.empty() || chunk_used + name.size() > chunk_size) {
+        chunk_size = std::max(INITIAL_CHUNK, name.size());
+        chunks.push_back(std::make_unique<char[]>(chunk_size));
+        chunk_used = 0;
+    }
+    char* text = chunks.back().get() + chunk_used;
+    std::memcpy(text, name.data(), name.size());
+    chunk_used += name.size();
+    return text;
+}
+
+void SymbolTable::Shard::grow() {
+    std::vector<Entry> old(slots.size() * 2);
+    old.swap(slots);
+    const size_t mask = slots.size() - 1;
+    for (const Entry& entry : old) {
+        if (entry.id == NO_SYMBOL) {
+            continue;
+        }
+        size_t i = entry.hash & mask;
+        while (slots[i].id != NO_SYMBOL) {
+            i = (i + 1) & mask;
+        }
+        slots[i] = entry;
+    }
+}
+
+uint32_t SymbolTable::intern(std::string_view name, uint64_t hash) {
+    Shard& shard = shards_[shard_index(hash)];
+    {
+        std::shared_lock lock(shard.mutex);
+        if (const Entry* entry = shard.lookup(name, hash)) LIKELY {
+            return entry->id;
+        }
+    }
+    
+    std::unique_lock lock(shard.mutex);
+    if (const Entry* entry = shard.lookup(name, hash)) {
+        return entry->id;   // Interned by another thread in between
+    }
+    
+    if ((shard.count + 1) * 2 > shard.slots.size()) {
+        shard.grow();
+    }
+    const char* text = shard.store(name);
+    uint32_t id = publish_name({text, name.size()});
+    
+    const size_t mask = shard.slots.size() - 1;
+    size_t i = hash & mask;
+    while (shard.slots[i].id != NO_SYMBOL) {
+        i = (i + 1) & mask;
+    }
+    shard.slots[i] = {hash, text, static_cast<uint32_t>(name.size()), id};
+    ++shard.count;
+    return id;
+}
+
+uint32_t SymbolTable::find(std::string_view name) const {
+    uint64_t hash = symbol_hash(name);
+    const Shard& shard = shards_[shard_index(hash)];
+    std::shared_lock lock(shard.mutex);
+    const Entry* entry = shard.lookup(name, hash);
+    return entry != nullptr ? entry->id : NO_SYMBOL;
+}
+
+uint32_t SymbolTable::publish_name(std::string_view name) {
+    // IDs are assigned under one lock, after the name is stored, so next_id_
+    // never counts an ID whose name a reader could still see half-written
+    std::lock_guard lock(publish_mutex_);
+    uint32_t id = next_id_.load(std::memory_order_relaxed);
+    if (id == UINT32_MAX) UNLIKELY {
+        throw std::length_error("SymbolTable: symbol ID space exhausted");
+    }
+    size_t segment = std::bit_width(id) - 1;
+    std::string_view* names = names_[segment].load(std::memory_order_relaxed);
+    if (names == nullptr) {
+        names = new std::string_view[size_t(1) << segment];
+        names_[segment].store(names, std::memory_order_relaxed);
+    }
+    names[id - (uint32_t(1) << segment)] = name;
+    next_id_.store(id + 1, std::memory_order_release);
+    return id;
+}
+
+std::string_view SymbolTable::name(uint32_t id) const noexcept {
+    if (id == NO_SYMBOL || id >= next_id_.load(std::memory_order_acquire)) {
+        return {};
+    }
+    size_t segment = std::bit_width(id) - 1;
+    const std::string_view* names = names_[segment].load(std::memory_order_acquire);
+    return names != nullptr ? names[id - (uint32_t(1) << segment)] : std::string_view{};
+}
+
+}  // namespace db25
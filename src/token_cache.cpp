@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "token_cache.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+
+namespace db25 {
+
+namespace {
+
+// XXH64 primes
+constexpr uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t PRIME3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t PRIME4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t PRIME5 = 0x27D4EB2F165667C5ULL;
+
+constexpr size_t WRITE_BATCH = 4096;   // Records converted per write() call
+
+inline uint64_t rotl(uint64_t x, int r) noexcept {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t load64(const std::byte* p) noexcept {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t load32(const std::byte* p) noexcept {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t xxh_round(uint64_t acc, uint64_t input) noexcept {
+    acc += input * PRIME2;
+    acc = rotl(acc, 31);
+    return acc * PRIME1;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t val) noexcept {
+    acc ^= xxh_round(0, val);
+    return acc * PRIME1 + PRIME4;
+}
+
+TokenRecord to_record(const Token& token, const std::byte* source) noexcept {
+    TokenRecord record{};
+    record.offset = static_cast<uint64_t>(
+        reinterpret_cast<const std::byte*>(token.value.data()) - source);
+    record.length = static_cast<uint32_t>(token.value.size());
+    record.line = token.line;
+    record.column = token.column;
+    record.type = token.type;
+    record.flags = token.reserved;
+    record.keyword_id = token.keyword_id;
+    return record;
+}
+
+}  // namespace
+
+const char* cache_status_name(CacheStatus status) noexcept {
+    switch (status) {
+        case CacheStatus::Valid: return "valid";
+        case CacheStatus::Missing: return "missing";
+        case CacheStatus::Corrupt: return "corrupt";
+        case CacheStatus::VersionMismatch: return "version mismatch";
+        case CacheStatus::SourceChanged: return "source changed";
+    }
+    return "unknown";
+}
+
+uint64_t source_checksum(const std::byte* data, size_t size) noexcept {
+    const std::byte* p = data;
+    const std::byte* end = data + size;
+    uint64_t hash;
+
+    if (size >= 32) {
+        // Four independent lanes keep the multipliers pipelined
+        uint64_t v1 = PRIME1 + PRIME2;
+        uint64_t v2 = PRIME2;
+        uint64_t v3 = 0;
+        uint64_t v4 = 0 - PRIME1;
+        const std::byte* limit = end - 32;
+        do {
+            v1 = xxh_round(v1, load64(p));
+            v2 = xxh_round(v2, load64(p + 8));
+            v3 = xxh_round(v3, load64(p + 16));
+            v4 = xxh_round(v4, load64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        hash = merge_round(hash, v1);
+        hash = merge_round(hash, v2);
+        hash = merge_round(hash, v3);
+        hash = merge_round(hash, v4);
+    } else {
+        hash = PRIME5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    while (p + 8 <= end) {
+        hash ^= xxh_round(0, load64(p));
+        hash = rotl(hash, 27) * PRIME1 + PRIME4;
+        p += 8;
+    }
+    if (p + 4 <= end) {
+        hash ^= static_cast<uint64_t>(load32(p)) * PRIME1;
+        hash = rotl(hash, 23) * PRIME2 + PRIME3;
+        p += 4;
+    }
+    while (p < end) {
+        hash ^= static_cast<uint64_t>(*p) * PRIME5;
+        hash = rotl(hash, 11) * PRIME1;
+        ++p;
+    }
+
+    hash ^= hash >> 33;
+    hash *= PRIME2;
+    hash ^= hash >> 29;
+    hash *= PRIME3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+void write_token_cache(const std::filesystem::path& path,
+                       const std::byte* source, size_t size,
+                       std::span<const Token> tokens) {
+    TokenCacheHeader header{};
+    std::memcpy(header.magic, TOKEN_CACHE_MAGIC, sizeof(header.magic));
+    header.version = TOKEN_CACHE_VERSION;
+    header.endian_tag = TOKEN_CACHE_ENDIAN_TAG;
+    header.header_size = sizeof(TokenCacheHeader);
+    header.record_size = sizeof(TokenRecord);
+    header.token_count = tokens.size();
+    header.source_size = size;
+    header.source_checksum = source_checksum(source, size);
+
+    // Write to a sibling file and rename, so concurrent readers never map a
+    // half-written cache
+    std::filesystem::path temp = path;
+    temp += ".tmp";
+
+    std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::system_error(errno, std::generic_category(), "open " + temp.string());
+    }
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::array<TokenRecord, WRITE_BATCH> batch;
+    for (size_t i = 0; i < tokens.size(); i += WRITE_BATCH) {
+        size_t count = std::min(WRITE_BATCH, tokens.size() - i);
+        for (size_t j = 0; j < count; ++j) {
+            batch[j] = to_record(tokens[i + j], source);
+        }
+        out.write(reinterpret_cast<const char*>(batch.data()),
+                  static_cast<std::streamsize>(count * sizeof(TokenRecord)));
+    }
+
+    out.close();
+    if (!out) {
+        int saved = errno;
+        std::error_code ignored;
+        std::filesystem::remove(temp, ignored);
+        throw std::system_error(saved, std::generic_category(), "write " + temp.string());
+    }
+
+    std::filesystem::rename(temp, path);
+}
+
+TokenCache::TokenCache(const std::filesystem::path& path) noexcept {
+    try {
+        file_ = MappedFile(path);
+    } catch (const std::system_error&) {
+        status_ = CacheStatus::Missing;
+        return;
+    }
+
+    if (file_.size() < sizeof(TokenCacheHeader)) {
+        status_ = CacheStatus::Corrupt;
+        return;
+    }
+
+    header_ = reinterpret_cast<const TokenCacheHeader*>(file_.data());
+    if (std::memcmp(header_->magic, TOKEN_CACHE_MAGIC, sizeof(header_->magic)) != 0) {
+        status_ = CacheStatus::Corrupt;
+        return;
+    }
+    if (header_->version != TOKEN_CACHE_VERSION ||
+        header_->endian_tag != TOKEN_CACHE_ENDIAN_TAG ||
+        header_->header_size != sizeof(TokenCacheHeader) ||
+        header_->record_size != sizeof(TokenRecord)) {
+        status_ = CacheStatus::VersionMismatch;
+        return;
+    }
+
+    size_t payload = file_.size() - sizeof(TokenCacheHeader);
+    if (payload / sizeof(TokenRecord) != header_->token_count ||
+        payload % sizeof(TokenRecord) != 0) {
+        status_ = CacheStatus::Corrupt;
+        return;
+    }
+
+    // The source checksum does not cover the records; check every token
+    // lies inside the source before token() forms views into it
+    std::span<const TokenRecord> records(
+        reinterpret_cast<const TokenRecord*>(file_.data() + sizeof(TokenCacheHeader)),
+        static_cast<size_t>(header_->token_count));
+    const uint64_t source_size = header_->source_size;
+    for (const TokenRecord& record : records) {
+        if (record.offset > source_size || record.length > source_size - record.offset) {
+            status_ = CacheStatus::Corrupt;
+            return;
+        }
+    }
+
+    records_ = records;
+    status_ = CacheStatus::Valid;
+}
+
+CacheStatus TokenCache::validate(const std::byte* source, size_t size) const noexcept {
+    if (status_ != CacheStatus::Valid) {
+        return status_;
+    }
+    if (header_->source_size != size ||
+        header_->source_checksum != source_checksum(source, size)) {
+        return CacheStatus::SourceChanged;
+    }
+    return CacheStatus::Valid;
+}
+
+Token TokenCache::token(size_t index, const std::byte* source) const noexcept {
+    const TokenRecord& record = records_[index];
+    Token token(record.type,
+                std::string_view(reinterpret_cast<const char*>(source) + record.offset, record.length),
+                record.line, record.column, record.keyword_id);
+    token.reserved = record.flags;
+    return token;
+}
+
+std::vector<Token> TokenCache::materialize(const std::byte* source) const {
+    std::vector<Token> tokens;
+    tokens.reserve(records_.size());
+    for (size_t i = 0; i < records_.size(); ++i) {
+        tokens.push_back(token(i, source));
+    }
+    return tokens;
+}
+
+CachedTokens load_or_tokenize(const std::filesystem::path& cache_path,
+                              const std::byte* source, size_t size,
+                              bool refresh) {
+    TokenCache cache(cache_path);
+    CacheStatus status = cache.validate(source, size);
+    if (status == CacheStatus::Valid) {
+        return {cache.materialize(source), status};
+    }
+
+    SimdTokenizer tokenizer(source, size);
+    CachedTokens result{tokenizer.tokenize(), status};
+    if (refresh) {
+        write_token_cache(cache_path, source, size, result.tokens);
+    }
+    return result;
+}
+
+}  // namespace db25
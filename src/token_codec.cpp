@@ -0,0 +1,448 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "token_codec.hpp"
+#include "simd_block_scan.hpp"
+#include "optimization_hints.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace db25 {
+
+namespace {
+
+constexpr uint8_t DELTA_ESCAPE = 15;
+constexpr uint8_t KEYWORD_ESCAPE = 0xFF;
+constexpr size_t MAX_DICTIONARY = KEYWORD_ESCAPE;
+constexpr uint8_t BLOCK_HAS_FLAGS = 0x01;
+constexpr std::array<uint8_t, 1> NEWLINE_CHAR = {'\n'};
+
+// Tokens whose length ends at the whitespace before the next token. They
+// never contain or end in whitespace; strings, comments and compound
+// keywords (ORDER BY, ...) may.
+constexpr bool implicit_length(TokenType type, Keyword keyword) noexcept {
+    switch (type) {
+        case TokenType::Keyword:
+            return !is_compound_keyword(keyword);
+        case TokenType::Identifier:
+        case TokenType::Number:
+        case TokenType::Operator:
+        case TokenType::Delimiter:
+            return true;
+        default:
+            return false;
+    }
+}
+
+inline bool is_whitespace(uint8_t ch) noexcept {
+    return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\r';
+}
+
+// End of an implicit-length token starting at `start`: `next` with the
+// whitespace in front of it trimmed
+inline size_t implicit_end(const uint8_t* data, size_t start, size_t next) noexcept {
+    while (next > start && is_whitespace(data[next - 1])) {
+        --next;
+    }
+    return next;
+}
+
+// Token::reserved as the tokenizer sets it: the OperatorKind of operator
+// and delimiter tokens, recomputed from the source instead of stored
+inline uint8_t implied_flags(const uint8_t* data, size_t size, TokenType type, size_t start) noexcept {
+    if ((type != TokenType::Operator && type != TokenType::Delimiter) || start >= size) {
+        return 0;
+    }
+    return static_cast<uint8_t>(match_operator(data + start, size - start).kind);
+}
+
+void put_varint(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+inline uint64_t get_varint(const uint8_t*& p, const uint8_t* end) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (p >= end) UNLIKELY {
+            break;
+        }
+        uint8_t byte = *p++;
+        value |= uint64_t(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return value;
+        }
+    }
+    throw std::invalid_argument("token codec: truncated varint");
+}
+
+[[noreturn]] void corrupt(const char* what) {
+    throw std::invalid_argument(std::string("token codec: ") + what);
+}
+
+// Line/column of monotonically increasing offsets in [begin, end). The
+// newlines of the range are collected up front one 64-byte block at a time
+// (match_block + countr_zero), so positioning a token is usually a single
+// compare against the next newline.
+class NewlineTracker {
+private:
+    std::vector<size_t> newlines_;
+    size_t next_ = 0;
+    size_t line_start_;       // Offset of column 1 on the current line
+    uint32_t line_;
+
+public:
+    template<typename Processor>
+    NewlineTracker(Processor processor, const uint8_t* data, size_t size,
+                   size_t begin, size_t end, uint32_t line, uint32_t column)
+        : line_start_(begin - (column - 1)), line_(line) {
+        uint8_t scratch[SCAN_BLOCK_SIZE];
+        for (size_t base = begin & ~(SCAN_BLOCK_SIZE - 1); base < end; base += SCAN_BLOCK_SIZE) {
+            uint64_t mask = match_block(processor, load_scan_block(data, size, base, scratch), NEWLINE_CHAR)[0];
+            if (base < begin) {
+                mask &= ~uint64_t(0) << (begin - base);
+            }
+            if (end - base < SCAN_BLOCK_SIZE) {
+                mask &= (uint64_t(1) << (end - base)) - 1;
+            }
+            while (mask != 0) {
+                newlines_.push_back(base + std::countr_zero(mask));
+                mask &= mask - 1;
+            }
+        }
+        newlines_.push_back(SIZE_MAX);
+    }
+
+    void advance(size_t offset) noexcept {
+        while (newlines_[next_] < offset) UNLIKELY {
+            ++line_;
+            line_start_ = newlines_[next_] + 1;
+            ++next_;
+        }
+    }
+
+    [[nodiscard]] uint32_t line() const noexcept { return line_; }
+    [[nodiscard]] uint32_t column(size_t offset) const noexcept {
+        return static_cast<uint32_t>(offset - line_start_ + 1);
+    }
+};
+
+template<typename Processor>
+size_t decode_block_impl(Processor processor, const CodecBlock& block, std::span<const uint8_t> bytes,
+                         size_t count, const std::byte* source, size_t source_size, Token* out) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(source);
+    const char* text = reinterpret_cast<const char*>(source);
+    const uint8_t* p = bytes.data();
+    const uint8_t* end = p + bytes.size();
+    
+    if (end - p < 2) UNLIKELY {
+        corrupt("truncated block");
+    }
+    size_t dictionary_size = *p++;
+    const uint8_t* dictionary = p;
+    p += dictionary_size * 2;
+    if (p >= end) UNLIKELY {
+        corrupt("truncated keyword dictionary");
+    }
+    bool has_flags = (*p++ & BLOCK_HAS_FLAGS) != 0;
+    
+    NewlineTracker tracker(processor, data, source_size, block.source_begin, block.source_end,
+                           block.line, block.column);
+    size_t start = block.source_begin;
+    for (size_t i = 0; i < count; ++i) {
+        if (p >= end) UNLIKELY {
+            corrupt("truncated token");
+        }
+        uint8_t header = *p++;
+        if ((header & 0x0F) > static_cast<uint8_t>(TokenType::DollarString)) UNLIKELY {
+            corrupt("invalid token type");
+        }
+        TokenType type = static_cast<TokenType>(header & 0x0F);
+        uint64_t delta = header >> 4;
+        if (delta == DELTA_ESCAPE) {
+            delta += get_varint(p, end);
+        }
+        if (delta > block.source_end - start) UNLIKELY {
+            corrupt("token outside its block");
+        }
+        start += delta;
+        
+        Keyword keyword = Keyword::UNKNOWN;
+        if (type == TokenType::Keyword) {
+            if (p >= end) UNLIKELY {
+                corrupt("truncated keyword");
+            }
+            uint8_t index = *p++;
+            uint16_t id;
+            if (index == KEYWORD_ESCAPE) {
+                if (end - p < 2) UNLIKELY {
+                    corrupt("truncated keyword");
+                }
+                std::memcpy(&id, p, sizeof(id));
+                p += 2;
+            } else {
+                if (index >= dictionary_size) UNLIKELY {
+                    corrupt("keyword index out of range");
+                }
+                std::memcpy(&id, dictionary + index * 2, sizeof(id));
+            }
+            keyword = static_cast<Keyword>(id);
+        }
+        
+        size_t length = 0;
+        if (!implicit_length(type, keyword)) {
+            length = get_varint(p, end);
+        }
+        if (length > block.source_end - start) UNLIKELY {
+            corrupt("token outside its block");
+        }
+        
+        // The previous token's implicit length ends where this one starts
+        if (i > 0 && implicit_length(out[i - 1].type, out[i - 1].keyword_id)) {
+            const char* previous = out[i - 1].value.data();
+            size_t previous_start = static_cast<size_t>(previous - text);
+            out[i - 1].value = std::string_view(previous, implicit_end(data, previous_start, start) - previous_start);
+        }
+        
+        tracker.advance(start);
+        out[i] = Token(type, std::string_view(text + start, length),
+                       tracker.line(), tracker.column(start), keyword);
+        if (has_flags) {
+            if (p >= end) UNLIKELY {
+                corrupt("truncated flags");
+            }
+            out[i].reserved = *p++;
+        } else {
+            out[i].reserved = implied_flags(data, source_size, type, start);
+        }
+    }
+    
+    if (count > 0 && implicit_length(out[count - 1].type, out[count - 1].keyword_id)) {
+        const char* last = out[count - 1].value.data();
+        out[count - 1].value = std::string_view(last, text + block.source_end - last);
+    }
+    
+    return count;
+}
+
+}  // namespace
+
+std::vector<uint8_t> encode_tokens(const std::byte* source, size_t size, std::span<const Token> tokens) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(source);
+    const char* text = reinterpret_cast<const char*>(source);
+    const size_t block_count = (tokens.size() + CODEC_BLOCK_TOKENS - 1) / CODEC_BLOCK_TOKENS;
+    
+    std::vector<CodecBlock> index(block_count);
+    std::vector<uint8_t> stream;
+    stream.reserve(tokens.size() * 2);
+    
+    auto offset_of = [&](const Token& token) {
+        const char* p = token.value.data();
+        if (p < text || p + token.value.size() > text + size) {
+            throw std::invalid_argument("token codec: token does not point into the source");
+        }
+        return static_cast<size_t>(p - text);
+    };
+    
+    SimdDispatcher dispatcher;
+    dispatcher.dispatch([&](auto processor) {
+        size_t last_end = tokens.empty() ? 0 : offset_of(tokens.back()) + tokens.back().value.size();
+        NewlineTracker tracker(processor, data, size, 0, last_end, 1, 1);
+        size_t previous_start = 0;
+        bool first = true;
+        
+        for (size_t b = 0; b < block_count; ++b) {
+            std::span<const Token> block = tokens.subspan(
+                b * CODEC_BLOCK_TOKENS, std::min(CODEC_BLOCK_TOKENS, tokens.size() - b * CODEC_BLOCK_TOKENS));
+            
+            CodecBlock& entry = index[b];
+            entry.stream_offset = stream.size();
+            entry.source_begin = offset_of(block.front());
+            entry.source_end = offset_of(block.back()) + block.back().value.size();
+            entry.line = block.front().line;
+            entry.column = block.front().column;
+            
+            // Keyword dictionary in order of first use
+            std::vector<uint16_t> dictionary;
+            bool has_flags = false;
+            for (const Token& token : block) {
+                has_flags |= token.reserved != implied_flags(data, size, token.type, offset_of(token));
+                auto id = static_cast<uint16_t>(token.keyword_id);
+                if (token.type == TokenType::Keyword && dictionary.size() < MAX_DICTIONARY &&
+                    std::find(dictionary.begin(), dictionary.end(), id) == dictionary.end()) {
+                    dictionary.push_back(id);
+                }
+            }
+            stream.push_back(static_cast<uint8_t>(dictionary.size()));
+            for (uint16_t id : dictionary) {
+                uint8_t raw[2];
+                std::memcpy(raw, &id, sizeof(raw));
+                stream.insert(stream.end(), raw, raw + 2);
+            }
+            stream.push_back(has_flags ? BLOCK_HAS_FLAGS : 0);
+            
+            for (size_t i = 0; i < block.size(); ++i) {
+                const Token& token = block[i];
+                size_t start = offset_of(token);
+                if ((!first && start <= previous_start) || static_cast<uint8_t>(token.type) > 0x0F) {
+                    throw std::invalid_argument("token codec: tokens are not in source order");
+                }
+                
+                // Positions must be reproducible from the source
+                tracker.advance(start);
+                if (token.line != tracker.line() || token.column != tracker.column(start)) {
+                    throw std::invalid_argument("token codec: token position does not match the source");
+                }
+                if (implicit_length(token.type, token.keyword_id)) {
+                    size_t next = i + 1 < block.size() ? offset_of(block[i + 1]) : entry.source_end;
+                    if (next < start || implicit_end(data, start, next) != start + token.value.size()) {
+                        throw std::invalid_argument("token codec: token length is not implicit in the source");
+                    }
+                }
+                
+                uint64_t delta = i == 0 ? 0 : start - previous_start;
+                previous_start = start;
+                first = false;
+                auto type_bits = static_cast<uint8_t>(token.type);
+                if (delta < DELTA_ESCAPE) {
+                    stream.push_back(static_cast<uint8_t>(type_bits | (delta << 4)));
+                } else {
+                    stream.push_back(static_cast<uint8_t>(type_bits | (DELTA_ESCAPE << 4)));
+                    put_varint(stream, delta - DELTA_ESCAPE);
+                }
+                
+                if (token.type == TokenType::Keyword) {
+                    auto id = static_cast<uint16_t>(token.keyword_id);
+                    auto it = std::find(dictionary.begin(), dictionary.end(), id);
+                    if (it != dictionary.end()) {
+                        stream.push_back(static_cast<uint8_t>(it - dictionary.begin()));
+                    } else {
+                        uint8_t raw[2];
+                        std::memcpy(raw, &id, sizeof(raw));
+                        stream.push_back(KEYWORD_ESCAPE);
+                        stream.insert(stream.end(), raw, raw + 2);
+                    }
+                }
+                if (!implicit_length(token.type, token.keyword_id)) {
+                    put_varint(stream, token.value.size());
+                }
+                if (has_flags) {
+                    stream.push_back(token.reserved);
+                }
+            }
+        }
+        return 0;
+    });
+    
+    CodecHeader header{};
+    std::memcpy(header.magic, TOKEN_CODEC_MAGIC, sizeof(header.magic));
+    header.version = TOKEN_CODEC_VERSION;
+    header.block_tokens = CODEC_BLOCK_TOKENS;
+    header.token_count = tokens.size();
+    header.block_count = block_count;
+    
+    std::vector<uint8_t> encoded(sizeof(header) + index.size() * sizeof(CodecBlock) + stream.size());
+    uint8_t* out = encoded.data();
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+    if (!index.empty()) {
+        std::memcpy(out, index.data(), index.size() * sizeof(CodecBlock));
+        out += index.size() * sizeof(CodecBlock);
+    }
+    if (!stream.empty()) {
+        std::memcpy(out, stream.data(), stream.size());
+    }
+    return encoded;
+}
+
+TokenDecoder::TokenDecoder(std::span<const uint8_t> encoded, const std::byte* source, size_t size)
+    : source_(source), source_size_(size) {
+    if (encoded.size() < sizeof(CodecHeader)) {
+        corrupt("buffer too small");
+    }
+    header_ = reinterpret_cast<const CodecHeader*>(encoded.data());
+    if (std::memcmp(header_->magic, TOKEN_CODEC_MAGIC, sizeof(header_->magic)) != 0) {
+        corrupt("bad magic");
+    }
+    if (header_->version != TOKEN_CODEC_VERSION || header_->block_tokens == 0) {
+        corrupt("unsupported version");
+    }
+    
+    uint64_t block_count = header_->block_count;
+    uint64_t expected_blocks = (header_->token_count + header_->block_tokens - 1) / header_->block_tokens;
+    size_t available = encoded.size() - sizeof(CodecHeader);
+    if (block_count != expected_blocks || block_count > available / sizeof(CodecBlock)) {
+        corrupt("bad block index");
+    }
+    
+    blocks_ = {reinterpret_cast<const CodecBlock*>(encoded.data() + sizeof(CodecHeader)),
+               static_cast<size_t>(block_count)};
+    stream_ = encoded.subspan(sizeof(CodecHeader) + blocks_.size() * sizeof(CodecBlock));
+    
+    for (size_t b = 0; b < blocks_.size(); ++b) {
+        const CodecBlock& block = blocks_[b];
+        uint64_t next = b + 1 < blocks_.size() ? blocks_[b + 1].stream_offset : stream_.size();
+        if (block.stream_offset > next || next > stream_.size() ||
+            block.source_begin > block.source_end || block.source_end > size ||
+            block.column == 0 || block.column - 1 > block.source_begin) {
+            corrupt("bad block index");
+        }
+    }
+}
+
+size_t TokenDecoder::block_size(size_t block) const noexcept {
+    size_t first = block * header_->block_tokens;
+    return std::min<size_t>(header_->block_tokens, header_->token_count - first);
+}
+
+size_t TokenDecoder::decode_block(size_t block, Token* out) const {
+    if (block >= blocks_.size()) {
+        throw std::out_of_range("token codec: block index out of range");
+    }
+    const CodecBlock& entry = blocks_[block];
+    size_t end = block + 1 < blocks_.size() ? blocks_[block + 1].stream_offset : stream_.size();
+    auto bytes = stream_.subspan(entry.stream_offset, end - entry.stream_offset);
+    
+    return dispatcher_.dispatch([&](auto processor) {
+        return decode_block_impl(processor, entry, bytes, block_size(block), source_, source_size_, out);
+    });
+}
+
+std::vector<Token> TokenDecoder::decode() const {
+    std::vector<Token> tokens(token_count());
+    Token* out = tokens.data();
+    for (size_t b = 0; b < blocks_.size(); ++b) {
+        out += decode_block(b, out);
+    }
+    return tokens;
+}
+
+Token TokenDecoder::at(size_t index) const {
+    if (index >= token_count()) {
+        throw std::out_of_range("token codec: token index out of range");
+    }
+    Token block[CODEC_BLOCK_TOKENS];
+    size_t block_index = index / header_->block_tokens;
+    if (header_->block_tokens > CODEC_BLOCK_TOKENS) {
+        std::vector<Token> large(block_size(block_index));
+        decode_block(block_index, large.data());
+        return large[index % header_->block_tokens];
+    }
+    decode_block(block_index, block);
+    return block[index % header_->block_tokens];
+}
+
+}  // namespace db25
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "token_generator.hpp"
+
+namespace db25 {
+
+FrameArena& thread_frame_arena() noexcept {
+    // Room for a handful of live generator frames per thread
+    thread_local InlineFrameArena<4096> arena;
+    arena.bind_to_current_thread();
+    return arena;
+}
+
+TokenGenerator generate_tokens(FrameArena& arena, SimdTokenizer& tokenizer) {
+    Token token;
+    while (tokenizer.next(token)) {
+        co_yield token;
+    }
+}
+
+TokenGenerator generate_tokens(SimdTokenizer& tokenizer) {
+    return generate_tokens(thread_frame_arena(), tokenizer);
+}
+
+}  // namespace db25
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include "token_pipeline.hpp"
+#include <algorithm>
+#include <bit>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #include <immintrin.h>
+#endif
+
+namespace db25 {
+
+namespace {
+
+// Spin iterations before parking on the futex-backed atomic wait
+constexpr int SPIN_LIMIT = 256;
+
+ALWAYS_INLINE void cpu_relax() noexcept {
+    #if defined(__x86_64__) || defined(_M_X64)
+    _mm_pause();
+    #elif defined(__aarch64__) || defined(_M_ARM64)
+    asm volatile("yield");
+    #endif
+}
+
+}  // namespace
+
+SpscTokenRing::SpscTokenRing(size_t capacity_blocks)
+    : slots_(std::make_unique<TokenBlock[]>(std::bit_ceil(std::max<size_t>(capacity_blocks, 2))))
+    , mask_(std::bit_ceil(std::max<size_t>(capacity_blocks, 2)) - 1) {}
+
+TokenBlock& SpscTokenRing::acquire_write() {
+    const uint64_t head = head_.load(std::memory_order_relaxed);
+    
+    if (head - cached_tail_ > mask_) UNLIKELY {
+        int spins = 0;
+        for (;;) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head - cached_tail_ <= mask_) {
+                break;
+            }
+            if (++spins < SPIN_LIMIT) {
+                cpu_relax();
+            } else {
+                tail_.wait(cached_tail_, std::memory_order_acquire);
+            }
+        }
+    }
+    
+    return slots_[head & mask_];
+}
+
+void SpscTokenRing::publish() {
+    head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    head_.notify_one();
+}
+
+const TokenBlock& SpscTokenRing::acquire_read() {
+    const uint64_t tail = tail_.load(std::memory_order_relaxed);
+    
+    if (tail == cached_head_) UNLIKELY {
+        int spins = 0;
+        for (;;) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (cached_head_ != tail) {
+                break;
+            }
+            if (++spins < SPIN_LIMIT) {
+                cpu_relax();
+            } else {
+                head_.wait(tail, std::memory_order_acquire);
+            }
+        }
+    }
+    
+    return slots_[tail & mask_];
+}
+
+void SpscTokenRing::release() {
+    tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    tail_.notify_one();
+}
+
+TokenPipeline::TokenPipeline(const std::byte* input, size_t size, size_t ring_blocks)
+    : ring_(ring_blocks)
+    , tokenizer_(input, size)
+    , producer_([this](std::stop_token stop) { produce(stop); }) {}
+
+TokenPipeline::~TokenPipeline() {
+    // Unblock a producer waiting on a full ring, then let it finish its final block
+    producer_.request_stop();
+    while (!finished_) {
+        (void)next_block();
+    }
+}
+
+void TokenPipeline::produce(std::stop_token stop) {
+    bool more = true;
+    
+    while (more) {
+        TokenBlock& block = ring_.acquire_write();
+        
+        uint32_t count = 0;
+        while (count < TokenBlock::CAPACITY) {
+            if (!tokenizer_.next(block.tokens[count])) {
+                more = false;
+                break;
+            }
+            ++count;
+        }
+        
+        if (stop.stop_requested()) UNLIKELY {
+            more = false;
+        }
+        
+        block.count = count;
+        block.end_of_stream = !more;
+        ring_.publish();
+    }
+}
+
+std::span<const Token> TokenPipeline::next_block() {
+    if (current_ != nullptr) {
+        ring_.release();
+        current_ = nullptr;
+    }
+    
+    if (finished_) {
+        return {};
+    }
+    
+    const TokenBlock& block = ring_.acquire_read();
+    finished_ = block.end_of_stream;
+    
+    if (block.count == 0) {
+        ring_.release();
+        return {};
+    }
+    
+    current_ = &block;
+    cursor_ = 0;
+    return {block.tokens.data(), block.count};
+}
+
+bool TokenPipeline::next(Token& out) {
+    while (current_ == nullptr || cursor_ >= current_->count) {
+        if (next_block().empty()) {
+            return false;
+        }
+    }
+    
+    out = current_->tokens[cursor_++];
+    return true;
+}
+
+}  // namespace db25
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cassert>
+#include "../include/arrow_export.hpp"
+#include "test_support.hpp"
+
+using namespace db25;
+using namespace db25::test;
+
+template<typename T>
+const T* column(const ArrowArray& array, size_t i) {
+    return static_cast<const T*>(array.children[i]->buffers[1]);
+}
+
+void test_schema() {
+    std::cout << "=== Schema ===\n";
+
+    ArrowSchema schema;
+    export_token_schema(&schema);
+    assert(std::strcmp(schema.format, "+s") == 0);
+    assert(schema.n_children == 6);
+
+    const char* names[] = {"type", "keyword_id", "offset", "length", "line", "statement"};
+    const char* formats[] = {"C", "S", "L", "I", "I", "I"};
+    for (int i = 0; i < 6; ++i) {
+        assert(std::strcmp(schema.children[i]->name, names[i]) == 0);
+        assert(std::strcmp(schema.children[i]->format, formats[i]) == 0);
+        assert((schema.children[i]->flags & ARROW_FLAG_NULLABLE) == 0);
+    }
+    schema.release(&schema);
+    assert(schema.release == nullptr);
+
+    std::cout << "✅ Struct of type, keyword_id, offset, length, line, statement\n";
+}
+
+void test_columns() {
+    std::cout << "\n=== Columns ===\n";
+
+    std::string sql = "SELECT a FROM t; -- note\nINSERT INTO t VALUES (1);\nCOMMIT";
+    ArrowArray array;
+    ArrowSchema schema;
+    size_t count = export_tokens_arrow(sql, &array, &schema);
+
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    auto tokens = tokenizer.tokenize();
+    assert(count == tokens.size());
+    assert(array.length == static_cast<int64_t>(count));
+    assert(array.null_count == 0 && array.n_children == 6);
+    for (int i = 0; i < 6; ++i) {
+        assert(array.children[i]->length == array.length);
+        assert(array.children[i]->n_buffers == 2 && array.children[i]->buffers[0] == nullptr);
+    }
+
+    const auto* type = column<uint8_t>(array, 0);
+    const auto* keyword = column<uint16_t>(array, 1);
+    const auto* offset = column<uint64_t>(array, 2);
+    const auto* length = column<uint32_t>(array, 3);
+    const auto* line = column<uint32_t>(array, 4);
+    const auto* statement = column<uint32_t>(array, 5);
+    for (size_t i = 0; i < count; ++i) {
+        assert(type[i] == static_cast<uint8_t>(tokens[i].type));
+        assert(keyword[i] == static_cast<uint16_t>(tokens[i].keyword_id));
+        assert(sql.substr(offset[i], length[i]) == tokens[i].value);
+        assert(line[i] == tokens[i].line);
+    }
+
+    // ';' belongs to the statement it closes
+    assert(statement[0] == 0);
+    assert(sql.substr(offset[4], length[4]) == ";" && statement[4] == 0);
+    assert(statement[5] == 1);                              // The comment starts statement 1
+    assert(statement[count - 1] == 2);                      // COMMIT
+
+    array.release(&array);
+    schema.release(&schema);
+    assert(array.release == nullptr && schema.release == nullptr);
+
+    ArrowExportOptions options;
+    options.emit_comments = false;
+    export_tokens_arrow(sql, &array, nullptr, options);
+    assert(static_cast<size_t>(array.length) == count - 1);
+    array.release(&array);
+
+    std::cout << "✅ " << count << " tokens match tokenize() column by column\n";
+}
+
+void test_move_child() {
+    std::cout << "\n=== Moved Child ===\n";
+
+    // A consumer may move a child out and release the parent first
+    ArrowArray array;
+    export_tokens_arrow("SELECT 1", &array);
+    ArrowArray offsets = *array.children[2];
+    array.children[2]->release = nullptr;
+    array.release(&array);
+
+    assert(offsets.length == 2 && offsets.n_buffers == 2 && offsets.buffers[0] == nullptr);
+    const auto* values = static_cast<const uint64_t*>(offsets.buffers[1]);
+    assert(values[0] == 0 && values[1] == 7);
+    offsets.release(&offsets);
+    assert(offsets.release == nullptr);
+
+    ArrowArray empty;
+    assert(export_tokens_arrow("", &empty) == 0);
+    assert(empty.length == 0 && empty.children[0]->length == 0);
+    empty.release(&empty);
+
+    std::cout << "✅ Children release independently; empty input exports an empty batch\n";
+}
+
+void test_corpus() {
+    std::cout << "\n=== Corpus ===\n";
+
+    std::string sql = load_corpus();
+
+    ArrowArray array;
+    size_t count = export_tokens_arrow(sql, &array);
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    auto tokens = tokenizer.tokenize();
+    assert(count == tokens.size());
+
+    const auto* offset = column<uint64_t>(array, 2);
+    const auto* statement = column<uint32_t>(array, 5);
+    uint32_t statements = 0;
+    for (size_t i = 0; i < count; ++i) {
+        assert(sql.data() + offset[i] == tokens[i].value.data());
+        assert(statement[i] == statements);
+        statements += tokens[i].operator_kind() == OperatorKind::Semicolon;
+    }
+    array.release(&array);
+
+    std::cout << "✅ " << count << " tokens across " << statements << " statements\n";
+}
+
+int main() {
+    std::cout << "Running Arrow Export Tests...\n\n";
+
+    test_schema();
+    test_columns();
+    test_move_child();
+    test_corpus();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
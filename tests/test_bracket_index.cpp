@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <cassert>
+#include "../include/simd_tokenizer.hpp"
+#include "test_support.hpp"
+
+using namespace db25;
+using namespace db25::test;
+
+constexpr uint32_t NO_MATCH = BracketIndex::NO_MATCH;
+
+static std::vector<Token> lex(const std::string& sql, BracketIndex& index) {
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    tokenizer.set_bracket_output(&index);
+    return tokenizer.tokenize();
+}
+
+void test_nesting() {
+    std::cout << "=== Nesting ===\n";
+
+    std::string sql = "SELECT f(a, (b + c)[1]) FROM (SELECT 1) t";
+    BracketIndex index;
+    auto tokens = lex(sql, index);
+    assert(tokens.size() == 20);
+    assert(index.match.size() == tokens.size() && index.depth.size() == tokens.size());
+    assert(index.balanced() && index.first_unbalanced() == NO_MATCH);
+
+    assert(index.match[2] == 13 && index.match[13] == 2);
+    assert(index.match[5] == 9 && index.match[9] == 5);
+    assert(index.match[10] == 12 && index.match[12] == 10);
+    assert(index.match[15] == 18 && index.match[18] == 15);
+    assert(index.match[0] == NO_MATCH && index.match[7] == NO_MATCH);
+
+    const uint32_t depths[] = {0, 0, 0, 1, 1, 1, 2, 2, 2, 1, 1, 2, 1, 0, 0, 0, 1, 1, 0, 0};
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        assert(index.depth[i] == depths[i]);
+    }
+
+    // Skipping the argument list and the subquery
+    assert(index.skip(2) == 14);
+    assert(index.skip(15) == 19);
+    assert(index.skip(13) == 14 && index.skip(0) == 1);
+
+    std::cout << "✅ Partners, depths and O(1) skips\n";
+}
+
+void test_unbalanced() {
+    std::cout << "\n=== Unbalanced Input ===\n";
+
+    BracketIndex index;
+    lex("a ) ( b", index);
+    assert(!index.balanced());
+    assert(index.first_mismatch == 1 && index.match[1] == NO_MATCH);
+    assert(index.open.size() == 1 && index.open[0].token == 2 && index.match[2] == NO_MATCH);
+    assert(index.first_unbalanced() == 1);
+
+    index.clear();
+    lex("( [ ) ]", index);
+    assert(index.first_mismatch == 2);
+    assert(index.match[1] == 3 && index.match[3] == 1);
+    assert(index.first_unbalanced() == 0);
+
+    // Brackets inside strings and comments are not delimiters
+    index.clear();
+    lex("f('(', \"[\") -- )\n/* { */", index);
+    assert(index.balanced() && index.match[1] == 5);
+
+    index.clear();
+    lex("{ a }", index);
+    assert(index.balanced() && index.match[0] == 2 && index.depth[1] == 1);
+
+    std::cout << "✅ Mismatched closers and unclosed openers reported in the same pass\n";
+}
+
+void test_corpus() {
+    std::cout << "\n=== Corpus ===\n";
+
+    std::string sql = load_corpus();
+
+    BracketIndex index;
+    auto tokens = lex(sql, index);
+    assert(index.match.size() == tokens.size());
+    assert(index.balanced());
+
+    // Every opener's partner is where a forward rescan finds it
+    size_t pairs = 0;
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        OperatorKind kind = tokens[i].operator_kind();
+        if (kind != OperatorKind::LeftParen && kind != OperatorKind::LeftBracket) {
+            continue;
+        }
+        size_t j = i + 1;
+        for (int level = 1; ; ++j) {
+            if (tokens[j].operator_kind() == kind) ++level;
+            if (static_cast<uint8_t>(tokens[j].operator_kind()) == static_cast<uint8_t>(kind) + 1 && --level == 0) break;
+        }
+        assert(index.match[i] == j && index.match[j] == i);
+        assert(index.depth[i] == index.depth[j]);
+        assert(i + 1 == j || index.depth[i + 1] == index.depth[i] + 1);
+        ++pairs;
+    }
+    assert(pairs > 0);
+
+    std::cout << "✅ " << pairs << " bracket pairs match a rescan\n";
+}
+
+int main() {
+    std::cout << "Running Bracket Index Tests...\n\n";
+
+    test_nesting();
+    test_unbalanced();
+    test_corpus();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
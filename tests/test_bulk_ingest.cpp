@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../include/bulk_ingest.hpp"
+
+using namespace db25;
+
+static std::filesystem::path make_corpus(std::vector<std::filesystem::path>& paths,
+                                         std::vector<std::string>& contents) {
+    auto dir = std::filesystem::temp_directory_path() / "db25_ingest_test";
+    std::filesystem::create_directories(dir);
+
+    for (int i = 0; i < 200; ++i) {
+        std::string id = std::to_string(i);
+        std::string sql = "SELECT c" + id + " FROM t WHERE x = " + id + ";\n";
+        // A few files exceed the buffer size and take the spill path
+        if (i % 50 == 7) {
+            while (sql.size() < 20000) sql += "INSERT INTO big VALUES (1, 'abc');\n";
+        }
+        auto path = dir / (std::to_string(i) + ".sql");
+        std::ofstream(path, std::ios::binary) << sql;
+        paths.push_back(path);
+        contents.push_back(sql);
+    }
+    paths.push_back(dir / "missing.sql");
+    contents.emplace_back();
+    return dir;
+}
+
+static void run_ingest(bool use_io_uring) {
+    std::vector<std::filesystem::path> paths;
+    std::vector<std::string> contents;
+    auto dir = make_corpus(paths, contents);
+
+    std::mutex mutex;
+    std::vector<int> seen(paths.size(), 0);
+    size_t expected_tokens = 0;
+    for (const auto& sql : contents) {
+        SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+        expected_tokens += tokenizer.tokenize().size();
+    }
+
+    IngestOptions options;
+    options.queue_depth = 8;
+    options.buffer_size = 4096;
+    options.workers = 3;
+    options.use_io_uring = use_io_uring;
+
+    auto stats = ingest_files(paths, [&](const IngestedFile& file) {
+        size_t index = &file.path - paths.data();
+        std::lock_guard lock(mutex);
+        ++seen[index];
+        if (index + 1 == paths.size()) {
+            assert(file.error == ENOENT);
+            assert(file.tokens.empty());
+        } else {
+            assert(file.error == 0);
+            assert(file.contents == contents[index]);
+            assert(!file.tokens.empty() && file.tokens[0].keyword_id == Keyword::SELECT);
+        }
+    }, options);
+
+    for (int count : seen) assert(count == 1);
+    assert(stats.files == paths.size() - 1);
+    assert(stats.failed == 1);
+    assert(stats.tokens == expected_tokens);
+    assert(!use_io_uring || stats.used_io_uring == io_uring_available());
+
+    std::cout << (stats.used_io_uring ? "io_uring" : "blocking") << ": "
+              << stats.files << " files, " << stats.tokens << " tokens\n";
+    std::filesystem::remove_all(dir);
+}
+
+void test_blocking_ingest() {
+    std::cout << "=== Blocking Ingest ===\n";
+    run_ingest(false);
+    std::cout << "✅ Every file delivered exactly once\n";
+}
+
+void test_io_uring_ingest() {
+    std::cout << "\n=== io_uring Ingest ===\n";
+    run_ingest(true);
+    std::cout << "✅ Every file delivered exactly once\n";
+}
+
+// A FIFO written in two halves returns a short first read; both paths
+// must keep reading until EOF
+static void run_short_reads(bool use_io_uring) {
+    auto dir = std::filesystem::temp_directory_path() / "db25_ingest_fifo";
+    std::filesystem::create_directories(dir);
+    std::vector<std::filesystem::path> paths = {dir / "pipe.sql"};
+    std::filesystem::remove(paths[0]);
+    assert(::mkfifo(paths[0].c_str(), 0600) == 0);
+
+    const std::string sql = "SELECT a FROM t;\nSELECT b FROM u;\n";
+    std::thread writer([&] {
+        int fd = ::open(paths[0].c_str(), O_WRONLY);
+        assert(fd >= 0);
+        size_t half = sql.size() / 2;
+        assert(::write(fd, sql.data(), half) == static_cast<ssize_t>(half));
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        assert(::write(fd, sql.data() + half, sql.size() - half) == static_cast<ssize_t>(sql.size() - half));
+        ::close(fd);
+    });
+
+    IngestOptions options;
+    options.queue_depth = 2;
+    options.buffer_size = 4096;
+    options.workers = 1;
+    options.use_io_uring = use_io_uring;
+    size_t delivered = 0;
+    auto stats = ingest_files(paths, [&](const IngestedFile& file) {
+        assert(file.error == 0);
+        assert(file.contents == sql);
+        assert(file.tokens.size() == 10);
+        ++delivered;
+    }, options);
+    writer.join();
+
+    assert(delivered == 1 && stats.files == 1 && stats.failed == 0);
+    std::filesystem::remove_all(dir);
+}
+
+void test_short_reads() {
+    std::cout << "\n=== Short Reads ===\n";
+    run_short_reads(false);
+    run_short_reads(true);
+    std::cout << "✅ A partial first read is continued to EOF\n";
+}
+
+int main() {
+    std::cout << "Running Bulk Ingest Tests...\n\n";
+
+    test_blocking_ingest();
+    test_io_uring_ingest();
+    test_short_reads();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
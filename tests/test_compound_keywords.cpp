@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <cassert>
+#include "../include/simd_tokenizer.hpp"
+#include "../include/token_codec.hpp"
+#include "test_support.hpp"
+
+using namespace db25;
+using namespace db25::test;
+
+template<typename Policy = DefaultTokenizerPolicy>
+static std::vector<Token> lex(const std::string& sql, bool compounds) {
+    BasicSimdTokenizer<Policy> tokenizer(bytes(sql), sql.size());
+    tokenizer.set_compound_keywords(compounds);
+    return tokenizer.tokenize();
+}
+
+void test_table() {
+    std::cout << "=== Compound Table ===\n";
+
+    for (const auto& entry : COMPOUND_KEYWORDS) {
+        assert(is_compound_keyword(entry.id));
+        assert(keyword_name(entry.id) == entry.text);
+        assert(keyword_has(entry.parts[0], KeywordAttr::COMPOUND_HEAD));
+        assert(keyword_has(entry.id, KeywordAttr::RESERVED));
+        assert(!keyword_has(entry.id, KeywordAttr::COMPOUND_HEAD));
+        assert(match_compound_keyword(entry.parts.data(), entry.part_count).keyword == entry.id);
+    }
+    assert(!is_compound_keyword(Keyword::AUTHORIZATION));
+    assert(keyword_has(Keyword::LEFT_OUTER_JOIN, KeywordAttr::JOIN));
+    assert(keyword_has(Keyword::ORDER_BY, KeywordAttr::CLAUSE_START));
+    assert(keyword_has(Keyword::IS_NOT_NULL, KeywordAttr::OPERATOR));
+
+    Keyword is_not[] = {Keyword::IS, Keyword::NOT};
+    CompoundMatch match = match_compound_keyword(is_not, 2);
+    assert(match.keyword == Keyword::UNKNOWN && match.extensible);
+
+    std::cout << "✅ " << COMPOUND_KEYWORDS.size() << " compound keywords with names and attributes\n";
+}
+
+void test_fusion() {
+    std::cout << "\n=== Fusion ===\n";
+
+    std::string sql = "SELECT a FROM t left  Outer\tJOIN u ON x WHERE b IS NOT NULL ORDER BY a";
+    auto tokens = lex(sql, true);
+    assert(tokens.size() == 13);
+    assert(tokens[4].keyword_id == Keyword::LEFT_OUTER_JOIN);
+    assert(tokens[4].value == "left  Outer\tJOIN");
+    assert(tokens[4].type == TokenType::Keyword);
+    assert(tokens[5].value == "u" && tokens[5].column == 34);
+    assert(tokens[10].keyword_id == Keyword::IS_NOT_NULL && tokens[10].value == "IS NOT NULL");
+    assert(tokens[11].keyword_id == Keyword::ORDER_BY);
+
+    // Comments and newlines between the words belong to the compound
+    std::string spread = "ORDER -- by what\n  /* key */ BY\nx";
+    tokens = lex(spread, true);
+    assert(tokens.size() == 2);
+    assert(tokens[0].keyword_id == Keyword::ORDER_BY && tokens[0].value.size() == spread.size() - 2);
+    assert(tokens[1].value == "x" && tokens[1].line == 3 && tokens[1].column == 1);
+    assert((lex<TokenizerPolicy<false, false>>(spread, true).size() == 2));
+
+    // Off by default and with KeywordMode::None
+    assert(lex(sql, false).size() == 18);
+    assert((lex<TokenizerPolicy<true, true, KeywordMode::None>>(sql, true).size() == 18));
+    assert((lex<TokenizerPolicy<true, true, KeywordMode::Full, LexerKind::Dfa>>(sql, true).size() == 13));
+
+    std::cout << "✅ Multi-word sequences fuse across whitespace and comments\n";
+}
+
+void test_longest_match() {
+    std::cout << "\n=== Longest Match and Rewind ===\n";
+
+    struct Case {
+        const char* sql;
+        std::vector<std::string_view> values;
+    };
+    const Case cases[] = {
+        {"a IS NOT DISTINCT FROM b", {"a", "IS NOT DISTINCT FROM", "b"}},
+        {"a IS NOT DISTINCT b", {"a", "IS", "NOT", "DISTINCT", "b"}},
+        {"a IS NOT TRUE", {"a", "IS", "NOT", "TRUE"}},
+        {"x NOT /* c */ NULL", {"x", "NOT /* c */ NULL"}},
+        {"LEFT OUTER x", {"LEFT", "OUTER", "x"}},
+        {"LEFT(s, 2)", {"LEFT", "(", "s", ",", "2", ")"}},
+        {"ORDER BYx", {"ORDER", "BYx"}},
+        {"ORDER BY\xC3\xA9", {"ORDER", "BY\xC3\xA9"}},
+        {"ORDER BY", {"ORDER BY"}},
+        {"ORDER ", {"ORDER"}},
+        {"GROUP -- only a comment", {"GROUP", "-- only a comment"}},
+        // CONFLICT and other non-reserved words can name tables and columns
+        {"JOIN conflict ON conflict.id = a.id", {"JOIN", "conflict", "ON", "conflict", ".", "id", "=", "a", ".", "id"}},
+        {"ON conflict = 1", {"ON", "conflict", "=", "1"}},
+        {"ON conflict . id", {"ON", "conflict", ".", "id"}},
+        {"ON CONFLICT (id) DO NOTHING", {"ON CONFLICT", "(", "id", ")", "DO NOTHING"}},
+        {"on conflict on constraint k", {"on conflict", "on", "constraint", "k"}},
+        {"ON CONFLICT\n  DO UPDATE", {"ON CONFLICT", "DO", "UPDATE"}},
+        {"ON CONFLICT DOx", {"ON", "CONFLICT", "DOx"}},
+        {"IS NOT null.x", {"IS", "NOT", "null", ".", "x"}},
+    };
+    for (const auto& c : cases) {
+        std::string sql = c.sql;
+        auto tokens = lex(sql, true);
+        assert(tokens.size() == c.values.size());
+        for (size_t i = 0; i < tokens.size(); ++i) {
+            assert(tokens[i].value == c.values[i]);
+        }
+    }
+
+    std::cout << "✅ Partial sequences rewind to the last complete compound\n";
+}
+
+void test_corpus() {
+    std::cout << "\n=== Corpus ===\n";
+
+    std::string sql = load_corpus();
+
+    auto plain = lex(sql, false);
+    auto fused = lex(sql, true);
+    assert(fused.size() < plain.size());
+
+    // Every fused token is a plain token; a compound covers the plain
+    // tokens up to its end
+    size_t j = 0, compounds = 0;
+    for (const Token& token : fused) {
+        assert(j < plain.size());
+        assert(plain[j].value.data() == token.value.data());
+        assert(plain[j].line == token.line && plain[j].column == token.column);
+        if (is_compound_keyword(token.keyword_id)) {
+            ++compounds;
+            const char* end = token.value.data() + token.value.size();
+            while (j < plain.size() && plain[j].value.data() < end) {
+                ++j;
+            }
+        } else {
+            assert(plain[j].type == token.type && plain[j].keyword_id == token.keyword_id);
+            assert(plain[j].value.size() == token.value.size());
+            ++j;
+        }
+    }
+    assert(j == plain.size());
+
+    // The codec stores compound lengths explicitly
+    auto encoded = encode_tokens(bytes(sql), sql.size(), fused);
+    auto decoded = TokenDecoder(encoded, bytes(sql), sql.size()).decode();
+    assert(decoded.size() == fused.size());
+    for (size_t i = 0; i < fused.size(); ++i) {
+        assert(decoded[i].keyword_id == fused[i].keyword_id);
+        assert(decoded[i].value.data() == fused[i].value.data());
+        assert(decoded[i].value.size() == fused[i].value.size());
+    }
+
+    std::cout << "✅ " << plain.size() << " tokens -> " << fused.size() << " (" << compounds
+              << " compounds), codec round-trip\n";
+}
+
+int main() {
+    std::cout << "Running Compound Keyword Tests...\n\n";
+
+    test_table();
+    test_fusion();
+    test_longest_match();
+    test_corpus();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string_view>
+#include <tuple>
+#include <cassert>
+#include "../include/constexpr_tokenizer.hpp"
+
+using namespace db25;
+
+// Lexed by the compiler; nothing below runs a tokenizer for these
+constexpr auto POINT_LOOKUP = tokenize_ct<"SELECT id, name FROM users WHERE id = ? AND status <> 'gone'">();
+static_assert(POINT_LOOKUP.size() == 14);
+static_assert(POINT_LOOKUP[0].type == TokenType::Keyword && POINT_LOOKUP[0].keyword == Keyword::SELECT);
+static_assert(POINT_LOOKUP[1].type == TokenType::Identifier);
+static_assert(POINT_LOOKUP[2].op == OperatorKind::Comma && POINT_LOOKUP[2].type == TokenType::Delimiter);
+static_assert(POINT_LOOKUP[12].op == OperatorKind::NotEqual);
+static_assert(POINT_LOOKUP.text(POINT_LOOKUP[13]) == "'gone'");
+
+constexpr auto MULTI_LINE = tokenize_ct<"select a -- first\n  from t /* b */\nwhere x >= 1.5e-3">();
+static_assert(MULTI_LINE[2].type == TokenType::Comment && MULTI_LINE.text(MULTI_LINE[2]) == "-- first\n");
+static_assert(MULTI_LINE[3].keyword == Keyword::FROM && MULTI_LINE[3].line == 2 && MULTI_LINE[3].column == 3);
+static_assert(MULTI_LINE[MULTI_LINE.size() - 1].type == TokenType::Number);
+static_assert(MULTI_LINE.text(MULTI_LINE[MULTI_LINE.size() - 1]) == "1.5e-3");
+
+// Storage is sized to the token count, not the input length
+static_assert(count_tokens("SELECT id, name FROM users WHERE id = ? AND status <> 'gone'") == 14);
+static_assert(std::tuple_size_v<decltype(POINT_LOOKUP.tokens)> == 14);
+static_assert(sizeof(POINT_LOOKUP) < sizeof(lex_ct("SELECT id, name FROM users WHERE id = ? AND status <> 'gone'")) / 3);
+static_assert(tokenize_ct<"">().size() == 0 && tokenize_ct<"">().source_size == 0);
+
+// Errors, reported by lex_ct(); tokenize_ct() would refuse to compile these
+static_assert(lex_ct("SELECT 'open").error == CtError::UnterminatedString);
+static_assert(lex_ct("SELECT 1 /* open").error == CtError::UnterminatedComment);
+static_assert(lex_ct("SELECT (1, 2").error == CtError::UnbalancedBrackets);
+static_assert(lex_ct("SELECT a[1)").error == CtError::UnbalancedBrackets);
+static_assert(lex_ct("SELECT a[1)").error_offset == 10);
+static_assert(lex_ct("SELECT \xC0").error == CtError::InvalidUtf8);
+static_assert(lex_ct("SELECT f(a[1], {x})").error == CtError::None);
+static_assert(lex_ct("").size() == 0);
+
+template<size_t N>
+void expect_same_as_runtime(const CtTokens<N>& ct) {
+    std::string_view sql(ct.source, ct.source_size);
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    auto tokens = tokenizer.tokenize();
+    assert(tokens.size() == ct.size());
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        Token token = ct.token(i);
+        assert(token.type == tokens[i].type);
+        assert(token.keyword_id == tokens[i].keyword_id);
+        assert(token.operator_kind() == tokens[i].operator_kind());
+        assert(token.value.data() == tokens[i].value.data());
+        assert(token.value.size() == tokens[i].value.size());
+        assert(token.line == tokens[i].line && token.column == tokens[i].column);
+    }
+}
+
+void test_matches_runtime() {
+    std::cout << "=== Matches SimdTokenizer ===\n";
+
+    static constexpr auto QUERIES = std::make_tuple(
+        POINT_LOOKUP,
+        MULTI_LINE,
+        tokenize_ct("INSERT INTO events (id, payload) VALUES (1, 'it''s'), (2, \"q\"\"id\")"),
+        tokenize_ct("UPDATE t SET x = x || 'a', y = y << 2 WHERE a::int >= 3 AND b != 4"),
+        tokenize_ct("WITH r AS (SELECT * FROM s) SELECT COUNT(*) FROM r GROUP BY 1 ORDER BY 2 DESC;"),
+        tokenize_ct("SELECT caf\xC3\xA9, \xE6\x97\xA5\xE6\x9C\xAC FROM t_1 WHERE _x IS NOT NULL"),
+        tokenize_ct("SELECT $1, @v, #t, :name, a->>'k', 007, 1e10, .5 FROM t\r\n-- tail"));
+
+    std::apply([](const auto&... queries) { (expect_same_as_runtime(queries), ...); }, QUERIES);
+
+    std::cout << "✅ " << std::tuple_size_v<decltype(QUERIES)> << " embedded queries lexed at compile time, "
+              << "identical to the runtime tokenizer\n";
+}
+
+int main() {
+    std::cout << "Running Constexpr Tokenizer Tests...\n\n";
+
+    test_matches_runtime();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <cassert>
+#include "../include/dollar_quote.hpp"
+#include "../include/statement_splitter.hpp"
+#include "test_support.hpp"
+
+using namespace db25;
+using namespace db25::test;
+
+std::vector<Token> tokenize(std::string_view sql, bool dollar = true) {
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    tokenizer.set_dollar_quotes(dollar);
+    return tokenizer.tokenize();
+}
+
+// Line and column of a token counted from the start of `sql`
+std::pair<uint32_t, uint32_t> position_of(std::string_view sql, const Token& token) {
+    uint32_t line = 1;
+    uint32_t column = 1;
+    for (const char* p = sql.data(); p < token.value.data(); ++p) {
+        if (*p == '\n') {
+            ++line;
+            column = 1;
+        } else {
+            ++column;
+        }
+    }
+    return {line, column};
+}
+
+void test_function_body() {
+    std::cout << "=== Function Body ===\n";
+
+    std::string_view sql = "CREATE FUNCTION f(a int) RETURNS int AS $body$\n"
+                           "DECLARE x int := $1;\n"
+                           "BEGIN\n"
+                           "  EXECUTE $q$SELECT 1; -- not a comment$q$;\n"
+                           "  RETURN a + x; -- done $$\n"
+                           "END;\n"
+                           "$body$ LANGUAGE plpgsql;\n"
+                           "SELECT 2;";
+    auto tokens = tokenize(sql);
+
+    assert(tokens.size() == 17);
+    const Token& quote = tokens[10];
+    assert(quote.type == TokenType::DollarString);
+    assert(quote.value.starts_with("$body$\nDECLARE") && quote.value.ends_with("END;\n$body$"));
+    assert(dollar_quote_tag(quote.value) == "$body$");
+    assert(dollar_quote_body(quote.value).starts_with("\nDECLARE") && dollar_quote_body(quote.value).ends_with("END;\n"));
+    assert(tokens[11].value == "LANGUAGE" && tokens[11].line == 7 && tokens[11].column == 8);
+    for (const Token& token : tokens) {
+        assert(position_of(sql, token) == std::make_pair(token.line, token.column));
+    }
+
+    // Lexed only on request, with positions in the enclosing input
+    DollarBodyTokenizer body(quote);
+    Token first;
+    assert(body.next(first) && first.value == "DECLARE" && first.line == 2 && first.column == 1);
+    auto inner = body.tokenize();
+    size_t nested = 0;
+    for (const Token& token : inner) {
+        assert(position_of(sql, token) == std::make_pair(token.line, token.column));
+        if (token.type == TokenType::DollarString) {
+            assert(token.value == "$q$SELECT 1; -- not a comment$q$" && token.line == 4 && token.column == 11);
+            ++nested;
+        }
+    }
+    assert(nested == 1);
+    assert(inner[4].value == "$" && inner[5].value == "1");   // Parameters are not quotes
+    assert(inner.back().value == ";" && inner.back().line == 6);
+
+    std::cout << "✅ Body as one token; " << inner.size() + 1 << " inner tokens lexed on demand\n";
+}
+
+void test_edge_cases() {
+    std::cout << "\n=== Edge Cases ===\n";
+
+    // Not quotes: $1, identifiers followed by '$', tags starting with a digit
+    std::string_view plain = "SELECT $1, a$b$c, x$$, $1$ FROM t";
+    auto tokens = tokenize(plain);
+    assert(tokens.size() == tokenize(plain, false).size());
+    for (const Token& token : tokens) {
+        assert(token.type != TokenType::DollarString);
+    }
+
+    tokens = tokenize("SELECT $$$$, $A$ x $a$ y $A$, $_t1$;$_t1$");
+    assert(tokens[1].value == "$$$$" && dollar_quote_body(tokens[1].value).empty());
+    assert(tokens[3].value == "$A$ x $a$ y $A$");   // Tags are case-sensitive
+    assert(tokens[5].value == "$_t1$;$_t1$" && dollar_quote_body(tokens[5].value) == ";");
+    assert(tokens.size() == 6);
+
+    // Unterminated: runs to the end of the input
+    tokens = tokenize("SELECT $fn$ body;\n more");
+    assert(tokens.size() == 2 && tokens[1].value == "$fn$ body;\n more");
+    assert(dollar_quote_body(tokens[1].value) == " body;\n more");
+
+    // A '$' at the very end
+    tokens = tokenize("SELECT $");
+    assert(tokens.size() == 2 && tokens[1].type == TokenType::Operator);
+
+    std::cout << "✅ Parameters, identifiers, case-sensitive and unterminated tags\n";
+}
+
+void test_splitter() {
+    std::cout << "\n=== Splitter ===\n";
+
+    StatementSplitter splitter;
+    splitter.set_dollar_quotes(true);
+
+    std::string corpus = load_corpus();
+    check_same(splitter, corpus, tokenize(corpus));
+
+    // Trigger body: its three inner ';' no longer split
+    StatementSplitter plain;
+    auto bodies = splitter.split(corpus);
+    assert(bodies.size() + 3 == plain.split(corpus).size());
+
+    // Closing tags straddling block edges
+    for (size_t pad = 0; pad < 140; ++pad) {
+        std::string sql = "SELECT $tag$" + std::string(pad, ';') + "$tag$;" + std::string(pad % 5, '$');
+        check_same(splitter, sql, tokenize(sql));
+    }
+
+    std::mt19937 rng(50);
+    const char* pieces[] = {"$$", "$a$", "$A$", "$", "a", "1", ";", "'", "\"", "--", "/*", "*/", "\n", " "};
+    for (int round = 0; round < 20000; ++round) {
+        std::string sql;
+        size_t count = rng() % 40;
+        for (size_t i = 0; i < count; ++i) {
+            sql += pieces[rng() % std::size(pieces)];
+        }
+        check_same(splitter, sql, tokenize(sql));
+    }
+
+    std::cout << "✅ Corpus and 20000 random inputs match the token-level split\n";
+}
+
+int main() {
+    std::cout << "Running Dollar Quote Tests...\n\n";
+
+    test_function_body();
+    test_edge_cases();
+    test_splitter();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <cassert>
+#include "../include/huge_token_buffer.hpp"
+
+using namespace db25;
+
+bool same_token(const Token& a, const Token& b) {
+    return a.type == b.type && a.keyword_id == b.keyword_id && a.line == b.line && a.column == b.column &&
+           a.value.data() == b.value.data() && a.value.size() == b.value.size() &&
+           a.operator_kind() == b.operator_kind();
+}
+
+void test_growth() {
+    std::cout << "=== Growth ===\n";
+
+    // Enough tokens for several mremap growths past the first 2 MiB
+    HugeTokenBuffer buffer;
+    const size_t count = 300000;
+    for (size_t i = 0; i < count; ++i) {
+        Token token(TokenType::Number, {}, static_cast<uint32_t>(i), static_cast<uint32_t>(i >> 3));
+        if (i % 2 == 0) {
+            buffer.push_back(token);
+        } else {
+            buffer.stream_back(token);
+        }
+    }
+    buffer.fence();
+    assert(buffer.size() == count);
+    assert(buffer.capacity() >= count);
+    assert(buffer.capacity() * sizeof(Token) % (2u << 20) == 0);
+    for (size_t i = 0; i < count; ++i) {
+        assert(buffer[i].line == i && buffer[i].column == (i >> 3));
+    }
+
+    HugeTokenBuffer moved = std::move(buffer);
+    assert(moved.size() == count && buffer.size() == 0 && buffer.capacity() == 0);
+    moved.clear();
+    assert(moved.empty() && moved.capacity() >= count);
+
+    std::cout << "✅ " << count << " tokens survive " << moved.capacity() * sizeof(Token) / (1u << 20)
+              << " MiB of mremap growth\n";
+}
+
+void test_tokenize_huge() {
+    std::cout << "\n=== tokenize_huge ===\n";
+
+    std::string sql;
+    for (int i = 0; i < 20000; ++i) {
+        sql += "SELECT a, 'str" + std::to_string(i) + "' FROM t WHERE x >= " + std::to_string(i) + "; -- c\n";
+    }
+    const auto* data = reinterpret_cast<const std::byte*>(sql.data());
+    SimdTokenizer tokenizer(data, sql.size());
+    auto expected = tokenizer.tokenize();
+
+    struct Variant {
+        bool huge_pages;
+        HugeBufferOptions options;
+    };
+    const Variant variants[] = {{true, {true, 2048}}, {true, {false, 0}}, {false, {true, 0}}, {false, {false, 64}}};
+    for (const auto& [huge_pages, options] : variants) {
+        HugeTokenBuffer buffer(huge_pages);
+        assert(tokenize_huge(data, sql.size(), buffer, options) == expected.size());
+        assert(buffer.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            assert(same_token(buffer[i], expected[i]));
+        }
+    }
+
+    // Appends
+    HugeTokenBuffer buffer;
+    tokenize_huge(data, sql.size(), buffer);
+    assert(tokenize_huge(reinterpret_cast<const std::byte*>("SELECT 1"), 8, buffer) == 2);
+    assert(buffer.size() == expected.size() + 2);
+    assert(buffer[expected.size()].value == "SELECT");
+
+    HugeTokenBuffer empty;
+    assert(tokenize_huge(data, 0, empty) == 0 && empty.tokens().empty());
+
+    std::cout << "✅ " << expected.size() << " tokens identical to tokenize() with and without streaming stores\n";
+}
+
+int main() {
+    std::cout << "Running Huge Token Buffer Tests...\n\n";
+
+    test_growth();
+    test_tokenize_huge();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
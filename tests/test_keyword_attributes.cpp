@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <cassert>
+#include "../include/simd_tokenizer.hpp"
+
+using namespace db25;
+
+static_assert(keyword_has(Keyword::SELECT, KeywordAttr::STATEMENT_START));
+static_assert(keyword_attributes(Keyword::UNKNOWN) == 0);
+
+void test_table_consistency() {
+    std::cout << "=== Attribute Table ===\n";
+
+    assert(KEYWORD_ATTRIBUTES.size() == KEYWORDS.size() + COMPOUND_KEYWORDS.size() + 1);
+    size_t reserved = 0;
+    for (const auto& entry : KEYWORDS) {
+        bool bit = keyword_has(entry.id, KeywordAttr::RESERVED);
+        assert(bit == entry.is_reserved);
+        reserved += bit;
+    }
+    assert(reserved > 0);
+
+    std::cout << "✅ RESERVED bit matches KeywordEntry::is_reserved for " << reserved << " keywords\n";
+}
+
+void test_categories() {
+    std::cout << "\n=== Categories ===\n";
+
+    assert(keyword_attributes(Keyword::SELECT) ==
+           (KeywordAttr::RESERVED | KeywordAttr::CLAUSE_START | KeywordAttr::STATEMENT_START));
+    assert(keyword_has(Keyword::WHERE, KeywordAttr::CLAUSE_START));
+    assert(keyword_has(Keyword::INTEGER, KeywordAttr::TYPE_NAME));
+    assert(keyword_has(Keyword::VARYING, KeywordAttr::TYPE_NAME));
+    assert(keyword_has(Keyword::LEFT, KeywordAttr::JOIN));
+    assert(keyword_has(Keyword::LATERAL, KeywordAttr::JOIN | KeywordAttr::CONTEXTUAL));
+    assert(keyword_has(Keyword::CAST, KeywordAttr::FUNCTION));
+    assert(keyword_has(Keyword::BETWEEN, KeywordAttr::OPERATOR));
+    assert(keyword_has(Keyword::KW_NULL, KeywordAttr::LITERAL));
+    assert(!keyword_has(Keyword::FROM, KeywordAttr::TYPE_NAME | KeywordAttr::JOIN));
+
+    std::cout << "✅ Clause, statement, type, join, function, operator and literal bits set\n";
+}
+
+void test_token_lookup() {
+    std::cout << "\n=== Token Lookup ===\n";
+
+    std::string sql = "SELECT CAST(x AS bigint) FROM a NATURAL JOIN b WHERE y IS NOT NULL";
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    size_t joins = 0;
+    for (const auto& token : tokenizer.tokenize()) {
+        uint16_t bits = token.keyword_attributes();
+        if (token.type != TokenType::Keyword) {
+            assert(bits == 0);
+        }
+        joins += (bits & KeywordAttr::JOIN) != 0;
+        if (token.value == "bigint") {
+            assert(bits & KeywordAttr::TYPE_NAME);
+        }
+    }
+    assert(joins == 2);
+
+    std::cout << "✅ Token::keyword_attributes() reads the table by keyword_id\n";
+}
+
+int main() {
+    std::cout << "Running Keyword Attribute Tests...\n\n";
+
+    test_table_consistency();
+    test_categories();
+    test_token_lookup();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
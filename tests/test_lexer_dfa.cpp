@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <cassert>
+#include "../include/simd_tokenizer.hpp"
+#include "../include/lexer_dfa.hpp"
+#include "test_support.hpp"
+
+using namespace db25;
+using namespace db25::test;
+
+using DfaPolicy = TokenizerPolicy<true, true, KeywordMode::Full, LexerKind::Dfa>;
+
+static DfaWord scan(const std::string& word) {
+    return dfa_scan_word(reinterpret_cast<const uint8_t*>(word.data()), word.size());
+}
+
+template<typename Policy>
+static std::vector<Token> lex(const std::string& sql) {
+    BasicSimdTokenizer<Policy> tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    return tokenizer.tokenize();
+}
+
+void test_keywords() {
+    std::cout << "=== Keyword Recognition ===\n";
+
+    for (const auto& entry : KEYWORDS) {
+        std::string upper(entry.text);
+        std::string lower = upper;
+        std::string mixed = upper;
+        for (size_t i = 0; i < upper.size(); ++i) {
+            lower[i] = static_cast<char>(upper[i] - 'A' + 'a');
+            if (i % 2) mixed[i] = lower[i];
+        }
+        for (const auto& word : {upper, lower, mixed}) {
+            DfaWord result = scan(word + " x");
+            assert(result.length == word.size());
+            assert(result.keyword == entry.id);
+        }
+        // Extensions and proper prefixes are identifiers
+        assert(scan(upper + "_").keyword == Keyword::UNKNOWN);
+        assert(scan(upper + "1").keyword == Keyword::UNKNOWN);
+        assert(scan(upper + "Q").keyword == find_keyword(upper + "Q"));
+        assert(scan(upper.substr(0, upper.size() - 1)).keyword == find_keyword(upper.substr(0, upper.size() - 1)));
+    }
+    assert(scan("1abc").length == 0);
+    assert(scan("_tmp1 ").length == 5);
+
+    std::cout << "✅ " << KEYWORDS.size() << " keywords in " << DFA_STATE_COUNT << " states\n";
+}
+
+void test_random_words() {
+    std::cout << "\n=== Random Words vs find_keyword ===\n";
+
+    std::mt19937 rng(39);
+    const char alphabet[] = "SELECTFROMWHEREINTOASselectfromwhere_019 ;(";
+    for (int round = 0; round < 100000; ++round) {
+        std::string word(rng() % 10 + 1, ' ');
+        for (auto& ch : word) ch = alphabet[rng() % (sizeof(alphabet) - 1)];
+        DfaWord result = scan(word);
+
+        size_t expected_length = 0;
+        if (!(word[0] >= '0' && word[0] <= '9')) {
+            while (expected_length < word.size() &&
+                   (std::isalnum(static_cast<unsigned char>(word[expected_length])) || word[expected_length] == '_')) {
+                ++expected_length;
+            }
+        }
+        assert(result.length == expected_length);
+        assert(result.keyword == (expected_length ? find_keyword(word.substr(0, expected_length)) : Keyword::UNKNOWN));
+    }
+
+    std::cout << "✅ 100000 words agree with the keyword table\n";
+}
+
+void test_tokenizer_equivalence() {
+    std::cout << "\n=== DFA Lexer vs Hand-Written ===\n";
+
+    std::string sql = load_corpus() + "\nSELECT caf\xC3\xA9, selectx, \xC3\xA9t\xC3\xA9 -- c\n/* b */ FROM t \xFF;";
+
+    auto expected = lex<DefaultTokenizerPolicy>(sql);
+    auto actual = lex<DfaPolicy>(sql);
+    assert(actual.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        assert(actual[i].type == expected[i].type);
+        assert(actual[i].keyword_id == expected[i].keyword_id);
+        assert(actual[i].reserved == expected[i].reserved);
+        assert(actual[i].value.data() == expected[i].value.data());
+        assert(actual[i].value.size() == expected[i].value.size());
+        assert(actual[i].line == expected[i].line && actual[i].column == expected[i].column);
+    }
+
+    auto router = lex<TokenizerPolicy<false, false, KeywordMode::Lookup, LexerKind::Dfa>>(sql);
+    auto router_expected = lex<RouterTokenizerPolicy>(sql);
+    assert(router.size() == router_expected.size());
+    for (size_t i = 0; i < router.size(); ++i) {
+        assert(router[i].type == router_expected[i].type && router[i].value == router_expected[i].value);
+    }
+
+    auto words = lex<TokenizerPolicy<true, true, KeywordMode::None, LexerKind::Dfa>>("SELECT a FROM b");
+    for (const auto& token : words) {
+        assert(token.type == TokenType::Identifier);
+    }
+
+    std::cout << "✅ " << expected.size() << " corpus tokens identical\n";
+}
+
+int main() {
+    std::cout << "Running Lexer DFA Tests...\n\n";
+
+    test_keywords();
+    test_random_words();
+    test_tokenizer_equivalence();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
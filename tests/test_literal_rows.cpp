@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cassert>
+#include "../include/simd_tokenizer.hpp"
+
+using namespace db25;
+
+std::vector<Token> tokenize(std::string_view sql, LiteralRowIndex* index, bool compound = false) {
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    tokenizer.set_literal_rows(index);
+    tokenizer.set_compound_keywords(compound);
+    return tokenizer.tokenize();
+}
+
+// Field texts of one row
+std::vector<std::string_view> row_text(std::string_view sql, const LiteralRowIndex& index, size_t list, size_t r) {
+    std::vector<std::string_view> out;
+    for (const LiteralField& field : index.row(index.lists[list], r)) {
+        out.push_back(LiteralRowIndex::text(sql, index.lists[list], field));
+    }
+    return out;
+}
+
+void test_values_rows() {
+    std::cout << "=== VALUES Rows ===\n";
+
+    std::string_view sql = "INSERT INTO t VALUES (1, 'a,b', NULL), (-2.5, 'it''s (x)', true),\n"
+                           "  (3e-2, '', DEFAULT);";
+    LiteralRowIndex index;
+    auto tokens = tokenize(sql, &index);
+
+    assert(tokens.size() == 6);
+    const Token& list = tokens[4];
+    assert(list.type == TokenType::LiteralList);
+    assert(list.value.front() == '(' && list.value.back() == ')');
+    assert(list.value.size() == sql.find(';') - sql.find('('));
+    assert(list.symbol_id == 1 && list.line == 1 && list.column == 22);
+    assert(tokens[5].value == ";" && tokens[5].line == 2 && tokens[5].column == 22);
+
+    assert(index.lists.size() == 1 && index.fields.size() == 9);
+    assert(index.lists[0].rows == 3 && index.lists[0].fields_per_row == 3);
+    assert((row_text(sql, index, 0, 0) == std::vector<std::string_view>{"1", "'a,b'", "NULL"}));
+    assert((row_text(sql, index, 0, 1) == std::vector<std::string_view>{"-2.5", "'it''s (x)'", "true"}));
+    assert((row_text(sql, index, 0, 2) == std::vector<std::string_view>{"3e-2", "''", "DEFAULT"}));
+
+    std::cout << "✅ 3 rows x 3 fields as one token, position after it on line 2\n";
+}
+
+void test_in_lists() {
+    std::cout << "\n=== IN Lists ===\n";
+
+    std::string_view sql = "SELECT * FROM t WHERE a IN (1, 2, 3) AND b NOT IN ('x', 'y') AND c IN (SELECT 1)";
+    LiteralRowIndex index;
+    auto tokens = tokenize(sql, &index, true);
+
+    size_t lists = 0;
+    for (const Token& token : tokens) {
+        if (token.type == TokenType::LiteralList) {
+            assert(token.symbol_id == ++lists);
+            assert(&index.list(token.symbol_id) == &index.lists[lists - 1]);
+        }
+    }
+    assert(lists == 2);
+    assert(index.lists[0].rows == 1 && index.lists[0].fields_per_row == 3);
+    assert((row_text(sql, index, 1, 0) == std::vector<std::string_view>{"'x'", "'y'"}));
+
+    // IN takes exactly one tuple: "IN (1), (2)" leaves the second to the lexer
+    index.clear();
+    tokens = tokenize("SELECT a IN (1), (2)", &index);
+    assert(index.lists.size() == 1 && index.lists[0].rows == 1);
+    assert(tokens.back().type == TokenType::Delimiter && tokens.back().value == ")");
+
+    std::cout << "✅ IN and fused NOT IN lists, subqueries left alone\n";
+}
+
+void test_fallback() {
+    std::cout << "\n=== Fallback ===\n";
+
+    // Rows up to the first non-literal or different-width row are kept
+    std::string_view sql = "INSERT INTO t VALUES (1, 2), (3, 4), (5, now()), (6, 7)";
+    LiteralRowIndex index;
+    auto with = tokenize(sql, &index);
+    auto without = tokenize(sql, nullptr);
+    assert(index.lists.size() == 1 && index.lists[0].rows == 2 && index.fields.size() == 4);
+    assert(with[4].type == TokenType::LiteralList && with[4].value == "(1, 2), (3, 4)");
+    assert(with[5].value == "," && with[5].column == 36);
+
+    // The rest of the stream is what the plain tokenizer produces
+    size_t skipped = without.size() - with.size() + 1;
+    for (size_t i = 5; i < with.size(); ++i) {
+        const Token& a = with[i];
+        const Token& b = without[i + skipped - 1];
+        assert(a.type == b.type && a.value.data() == b.value.data() && a.line == b.line && a.column == b.column);
+    }
+
+    const char* rejected[] = {
+        "INSERT INTO t VALUES (1, 2), (3)",            // Second row narrower: only the first is taken
+        "INSERT INTO t VALUES (x, 1)",                  // Identifier
+        "INSERT INTO t VALUES ((1), 2)",                // Nested parentheses
+        "INSERT INTO t VALUES (1 + 2)",                 // Expression
+        "INSERT INTO t VALUES ('a' 'b')",               // Two strings in one field
+        "INSERT INTO t VALUES ()",                      // Empty row
+        "INSERT INTO t VALUES (1, 'open",               // Unterminated string
+        "INSERT INTO t VALUES (1.2.3)",                 // Malformed number
+    };
+    for (const char* query : rejected) {
+        index.clear();
+        auto tokens = tokenize(query, &index);
+        size_t lists = 0;
+        for (const Token& token : tokens) {
+            lists += token.type == TokenType::LiteralList;
+        }
+        assert(lists == index.lists.size());
+        assert(index.lists.size() <= 1);
+        if (index.lists.empty()) {
+            assert(index.fields.empty());
+            assert(tokens.size() == tokenize(query, nullptr).size());
+        } else {
+            assert(index.lists[0].rows == 1 && index.fields.size() == 2);
+        }
+    }
+
+    // Disabled by default
+    for (const Token& token : without) {
+        assert(token.type != TokenType::LiteralList);
+    }
+
+    std::cout << "✅ Non-literal rows end the list; the rest lexes as before\n";
+}
+
+void test_large_dump() {
+    std::cout << "\n=== Large Dump ===\n";
+
+    std::string sql = "INSERT INTO events VALUES ";
+    const size_t rows = 5000;
+    for (size_t i = 0; i < rows; ++i) {
+        sql += (i ? ",\n(" : "(") + std::to_string(i) + ", 'name " + std::to_string(i) +
+               " with ''quotes'', commas, (parens)', " + std::to_string(i * 0.25) + ", NULL)";
+    }
+    sql += ";\nSELECT 1;";
+
+    LiteralRowIndex index;
+    auto tokens = tokenize(sql, &index);
+    assert(tokens.size() == 9);
+    assert(index.lists[0].rows == rows && index.lists[0].fields_per_row == 4);
+    assert(index.fields.size() == rows * 4);
+    for (size_t r = 0; r < rows; r += 997) {
+        auto fields = row_text(sql, index, 0, r);
+        assert(fields[0] == std::to_string(r));
+        assert(fields[1].starts_with("'name ") && fields[1].ends_with("(parens)'"));
+        assert(fields[3] == "NULL");
+    }
+    assert(tokens[6].value == "SELECT" && tokens[6].line == rows + 1 && tokens[6].column == 1);
+
+    std::cout << "✅ " << rows << " rows, " << sql.size() << " bytes in " << tokens.size() << " tokens\n";
+}
+
+int main() {
+    std::cout << "Running Literal Rows Tests...\n\n";
+
+    test_values_rows();
+    test_in_lists();
+    test_fallback();
+    test_large_dump();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <cassert>
+#include "../include/mapped_file.hpp"
+
+using namespace db25;
+
+static std::filesystem::path write_temp(const std::string& name, const std::string& contents) {
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream(path, std::ios::binary) << contents;
+    return path;
+}
+
+void test_tokenize_file_zero_copy() {
+    std::cout << "=== Zero-Copy File Tokenization ===\n";
+
+    std::string sql = "SELECT a, b\nFROM t -- c\nWHERE a = 'x';\n";
+    auto path = write_temp("db25_test_mapped.sql", sql);
+
+    SimdTokenizer reference(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    auto expected = reference.tokenize();
+
+    auto result = tokenize_file(path, MapOptions{.sequential = true, .huge_pages = true});
+    assert(result.source() == sql);
+    assert(result.tokens().size() == expected.size());
+
+    const char* begin = result.source().data();
+    const char* end = begin + result.source().size();
+    for (size_t i = 0; i < expected.size(); ++i) {
+        const Token& token = result.tokens()[i];
+        assert(token.type == expected[i].type);
+        assert(token.value == expected[i].value);
+        assert(token.line == expected[i].line);
+        assert(token.value.data() >= begin && token.value.data() + token.value.size() <= end);
+    }
+
+    // Views survive moving the handle
+    TokenizedFile moved = std::move(result);
+    assert(moved.tokens()[0].value == "SELECT");
+
+    std::filesystem::remove(path);
+    std::cout << "✅ Token views point into the mapping\n";
+}
+
+void test_empty_and_missing() {
+    std::cout << "\n=== Empty and Missing Files ===\n";
+
+    auto path = write_temp("db25_test_empty.sql", "");
+    auto result = tokenize_file(path);
+    assert(result.tokens().empty());
+    assert(result.file().empty());
+    std::filesystem::remove(path);
+
+    bool threw = false;
+    try {
+        MappedFile missing("/nonexistent/db25/none.sql");
+    } catch (const std::system_error& e) {
+        threw = true;
+        assert(e.code() == std::errc::no_such_file_or_directory);
+    }
+    assert(threw);
+
+    std::cout << "✅ Empty file yields no tokens, missing file throws\n";
+}
+
+int main() {
+    std::cout << "Running Mapped File Tests...\n\n";
+
+    test_tokenize_file_zero_copy();
+    test_empty_and_missing();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <random>
+#include <cmath>
+#include <cassert>
+#include "../include/simd_tokenizer.hpp"
+
+using namespace db25;
+
+static double reference_double(std::string_view text) {
+    double value = 0.0;
+    std::from_chars(text.data(), text.data() + text.size(), value);
+    return value;
+}
+
+static void check_processors(std::string_view text) {
+    NumericValue scalar = parse_numeric_literal(ScalarProcessor{}, text);
+    NumericValue simd = parse_numeric_literal(text);
+    assert(scalar.mantissa == simd.mantissa);
+    assert(scalar.exponent == simd.exponent);
+    assert(scalar.flags == simd.flags);
+    assert(scalar.kind == simd.kind);
+    assert(scalar.value == simd.value || (std::isnan(scalar.value) && std::isnan(simd.value)));
+}
+
+void test_literal_forms() {
+    std::cout << "=== Literal Forms ===\n";
+
+    auto v = parse_numeric_literal("42");
+    assert(v.kind == NumericKind::Integer && v.integer() == 42 && v.exponent == 0 && v.value == 42.0);
+
+    v = parse_numeric_literal("12.50");
+    assert(v.kind == NumericKind::Decimal && v.mantissa == 1250 && v.scale() == 2 && v.value == 12.5);
+
+    v = parse_numeric_literal("0.000120");
+    assert(v.kind == NumericKind::Decimal && v.mantissa == 120 && v.scale() == 6);
+    assert(v.value == 0.00012);
+
+    v = parse_numeric_literal("1.5e-3");
+    assert(v.kind == NumericKind::Float && v.mantissa == 15 && v.exponent == -4 && v.value == 1.5e-3);
+
+    v = parse_numeric_literal("007");
+    assert(v.integer() == 7);
+
+    // Forms the tokenizer accepts without trailing digits
+    assert(parse_numeric_literal("1.").mantissa == 1 && parse_numeric_literal("1.").kind == NumericKind::Decimal);
+    assert(parse_numeric_literal("2e").value == 2.0);
+    assert(parse_numeric_literal("2E+").kind == NumericKind::Float);
+
+    std::cout << "✅ Integers, NUMERIC mantissa/scale and floats\n";
+}
+
+void test_overflow() {
+    std::cout << "\n=== Overflow ===\n";
+
+    auto max = parse_numeric_literal("9223372036854775807");
+    assert(!max.overflow() && max.integer() == INT64_MAX);
+
+    auto over = parse_numeric_literal("9223372036854775808");
+    assert(over.overflow());
+    assert(over.value == 9223372036854775808.0);
+
+    // Bound holds wherever the decimal point splits the digits
+    auto split = parse_numeric_literal("922337203685477580.7");
+    assert(!split.overflow() && split.mantissa == INT64_MAX && split.scale() == 1);
+    assert(parse_numeric_literal("922337203685477580.8").overflow());
+    auto fraction = parse_numeric_literal("0.9223372036854775807");
+    assert(!fraction.overflow() && fraction.mantissa == INT64_MAX && fraction.scale() == 19);
+    assert(parse_numeric_literal("0.9999999999999999999").overflow());
+
+    auto wide = parse_numeric_literal("123456789012345678901234567890.5");
+    assert(wide.overflow() && wide.value == reference_double("123456789012345678901234567890.5"));
+
+    // Significant digits only: leading zeros do not count
+    auto padded = parse_numeric_literal("0000000000000000000000001.25");
+    assert(!padded.overflow() && padded.mantissa == 125 && padded.scale() == 2);
+
+    assert(std::isinf(parse_numeric_literal("1e400").value));
+    assert(parse_numeric_literal("1e-400").value == 0.0);
+    assert(std::isinf(parse_numeric_literal(std::string(400, '9')).value));
+
+    std::cout << "✅ Overflow flagged, doubles still correct\n";
+}
+
+void test_random_against_from_chars() {
+    std::cout << "\n=== Randomized vs from_chars ===\n";
+
+    std::mt19937_64 rng(33);
+    for (int round = 0; round < 100000; ++round) {
+        std::string text = std::to_string(rng() >> (rng() % 64));
+        if (rng() % 2) {
+            text += '.';
+            text += std::to_string(rng() % 1000000);
+        }
+        if (rng() % 4 == 0) {
+            text += (rng() % 2) ? "e-" : "e";
+            text += std::to_string(rng() % 40);
+        }
+        check_processors(text);
+
+        NumericValue v = parse_numeric_literal(text);
+        assert(v.value == reference_double(text));
+        if (!v.overflow() && v.kind == NumericKind::Integer) {
+            int64_t expected = 0;
+            std::from_chars(text.data(), text.data() + text.size(), expected);
+            assert(v.integer() == expected);
+        }
+    }
+
+    std::cout << "✅ 100000 literals match from_chars\n";
+}
+
+void test_tokenizer_side_channel() {
+    std::cout << "\n=== Tokenizer Side Channel ===\n";
+
+    std::string sql = "INSERT INTO t VALUES (1, 2.50, 'x9', -3e2), (99999999999999999999, 0);";
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    std::vector<NumericValue> values;
+    tokenizer.set_numeric_output(&values);
+    auto tokens = tokenizer.tokenize();
+
+    size_t numbers = 0;
+    for (const auto& token : tokens) {
+        numbers += token.type == TokenType::Number;
+    }
+    assert(values.size() == numbers && numbers == 5);
+
+    for (const auto& value : values) {
+        assert(tokens[value.token_index].type == TokenType::Number);
+        assert(value.value == reference_double(tokens[value.token_index].value));
+    }
+    assert(values[0].integer() == 1);
+    assert(values[1].mantissa == 250 && values[1].scale() == 2);
+    assert(values[2].kind == NumericKind::Float && values[2].value == 300.0);
+    assert(values[3].overflow());
+
+    // Disabled by default: tokens are unchanged either way
+    SimdTokenizer plain(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    assert(plain.tokenize().size() == tokens.size());
+
+    std::cout << "✅ " << values.size() << " values aligned with Number tokens\n";
+}
+
+int main() {
+    std::cout << "Running Numeric Literal Tests...\n\n";
+
+    test_literal_forms();
+    test_overflow();
+    test_random_against_from_chars();
+    test_tokenizer_side_channel();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
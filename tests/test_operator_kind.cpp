@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <cassert>
+#include "../include/simd_tokenizer.hpp"
+#include "../include/grammar_dispatch.hpp"
+
+using namespace db25;
+
+static std::vector<Token> lex(const std::string& sql) {
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    return tokenizer.tokenize();
+}
+
+// Precedence lookups are usable at compile time
+static_assert(PrecedenceTable::get_precedence(OperatorKind::Star) == PrecedenceTable::MULTIPLICATIVE);
+static_assert(PrecedenceTable::get_precedence("<>") == PrecedenceTable::EQUALITY);
+static_assert(PrecedenceTable::get_precedence("==") == PrecedenceTable::EQUALITY);
+static_assert(operator_kind("->>") == OperatorKind::ArrowText);
+static_assert(operator_kind("AND") == OperatorKind::None);
+
+void test_spellings() {
+    std::cout << "=== Operator Spellings ===\n";
+
+    for (const auto& spelling : operator_detail::SPELLINGS) {
+        std::string sql = "a " + std::string(spelling.text) + " b";
+        auto tokens = lex(sql);
+        assert(tokens.size() == 3);
+        assert(tokens[1].value == spelling.text);
+        assert(tokens[1].operator_kind() == spelling.kind);
+        assert(tokens[1].type == (is_delimiter_kind(spelling.kind) ? TokenType::Delimiter : TokenType::Operator));
+        assert(operator_kind(spelling.text) == spelling.kind);
+    }
+    assert(lex("a b")[0].operator_kind() == OperatorKind::None);
+    assert(lex("$1")[0].operator_kind() == OperatorKind::Other);
+
+    std::cout << "✅ " << std::size(operator_detail::SPELLINGS) << " spellings lex to their kinds\n";
+}
+
+void test_postgres_operators() {
+    std::cout << "\n=== PostgreSQL Operators ===\n";
+
+    auto tokens = lex("SELECT doc->'a'->>'b', doc#>>'{x,y}', tags@>ARRAY['k'], x::int, name!~*'^a' FROM t");
+    std::vector<OperatorKind> kinds;
+    for (const auto& token : tokens) {
+        if (token.type == TokenType::Operator) kinds.push_back(token.operator_kind());
+    }
+    std::vector<OperatorKind> expected = {
+        OperatorKind::Arrow, OperatorKind::ArrowText, OperatorKind::HashArrowText,
+        OperatorKind::Contains, OperatorKind::Cast, OperatorKind::RegexNotMatchInsensitive
+    };
+    assert(kinds == expected);
+
+    // Standard SQL is lexed as before
+    tokens = lex("x=-1 AND y<>2 OR z<=-3");
+    assert(tokens[1].operator_kind() == OperatorKind::Equal);
+    assert(tokens[2].operator_kind() == OperatorKind::Minus);
+    assert(tokens[6].operator_kind() == OperatorKind::NotEqual);
+    assert(tokens[10].operator_kind() == OperatorKind::LessEqual);
+    assert(tokens[11].operator_kind() == OperatorKind::Minus);
+
+    // A dash before a line comment stays a dash
+    tokens = lex("a->--x\nb");
+    assert(tokens[1].value == "->" && tokens[2].type == TokenType::Comment);
+
+    std::cout << "✅ JSON, containment, cast and regex operators are single tokens\n";
+}
+
+void test_random_operator_runs() {
+    std::cout << "\n=== Random Operator Runs ===\n";
+
+    std::mt19937 rng(37);
+    const char alphabet[] = "-<>=!|&:#@?~*+/%^.(),;[]{}a ";
+    for (int round = 0; round < 20000; ++round) {
+        std::string sql(rng() % 12 + 1, ' ');
+        for (auto& ch : sql) ch = alphabet[rng() % (sizeof(alphabet) - 1)];
+        for (const auto& token : lex(sql)) {
+            if (token.type == TokenType::Operator || token.type == TokenType::Delimiter) {
+                assert(token.operator_kind() == operator_kind(token.value));
+                assert(token.operator_kind() != OperatorKind::None);
+            }
+        }
+    }
+
+    std::cout << "✅ Token kinds match operator_kind() of their text\n";
+}
+
+void test_precedence() {
+    std::cout << "\n=== Precedence by Kind ===\n";
+
+    struct Case { const char* op; PrecedenceTable::Precedence prec; };
+    const Case cases[] = {
+        {"<>", PrecedenceTable::EQUALITY}, {"!=", PrecedenceTable::EQUALITY},
+        {"<=", PrecedenceTable::COMPARISON}, {">=", PrecedenceTable::COMPARISON},
+        {"||", PrecedenceTable::LOGICAL_OR}, {"&&", PrecedenceTable::LOGICAL_AND},
+        {"<<", PrecedenceTable::SHIFT}, {">>", PrecedenceTable::SHIFT},
+        {"=", PrecedenceTable::ASSIGNMENT}, {"<", PrecedenceTable::COMPARISON},
+        {">", PrecedenceTable::COMPARISON}, {"+", PrecedenceTable::ADDITIVE},
+        {"-", PrecedenceTable::ADDITIVE}, {"*", PrecedenceTable::MULTIPLICATIVE},
+        {"/", PrecedenceTable::MULTIPLICATIVE}, {"%", PrecedenceTable::MULTIPLICATIVE},
+        {"&", PrecedenceTable::BITWISE_AND}, {"|", PrecedenceTable::BITWISE_OR},
+        {"^", PrecedenceTable::BITWISE_XOR}, {"!", PrecedenceTable::UNARY},
+        {"~", PrecedenceTable::UNARY}, {"::", PrecedenceTable::POSTFIX},
+        {"->>", PrecedenceTable::OTHER_OPERATOR}, {"@>", PrecedenceTable::OTHER_OPERATOR},
+        // Had no precedence before kinds: == binds as equality, . as postfix
+        {"==", PrecedenceTable::EQUALITY}, {".", PrecedenceTable::POSTFIX},
+        {"=>", PrecedenceTable::NONE},
+        {"(", PrecedenceTable::NONE}, {"AND", PrecedenceTable::NONE}, {"", PrecedenceTable::NONE},
+    };
+    for (const auto& c : cases) {
+        assert(PrecedenceTable::get_precedence(c.op) == c.prec);
+    }
+
+    std::cout << "✅ String and kind lookups agree\n";
+}
+
+int main() {
+    std::cout << "Running Operator Kind Tests...\n\n";
+
+    test_spellings();
+    test_postgres_operators();
+    test_random_operator_runs();
+    test_precedence();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
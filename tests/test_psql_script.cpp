@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cassert>
+#include "../include/psql_script.hpp"
+#include "../include/simd_tokenizer.hpp"
+#include "../include/statement_splitter.hpp"
+#include "test_support.hpp"
+
+using namespace db25;
+using namespace db25::test;
+
+template<typename Tokenizer = SimdTokenizer>
+std::vector<Token> tokenize(std::string_view sql, bool psql = true) {
+    Tokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    tokenizer.set_psql_script(psql);
+    return tokenizer.tokenize();
+}
+
+void test_pg_dump() {
+    std::cout << "=== pg_dump Script ===\n";
+
+    std::string_view sql =
+        "\\restrict Gx3k9\n"
+        "SET client_encoding = 'UTF8';\n"
+        "--\n"
+        "-- Data for Name: users; Type: TABLE DATA; Schema: public\n"
+        "--\n\n"
+        "COPY public.users (id, name, bio) FROM stdin;\n"
+        "1\tann\t'quoted'; -- not a comment\n"
+        "2\t\\N\tback\\\\slash \\. mid-line\n"
+        "\\.x is data too\n"
+        "\\.\n"
+        "SELECT 1;\n"
+        "\\connect other\r\n"
+        "COPY t FROM STDIN WITH (FORMAT csv);   \r\n"
+        "a,b\r\n"
+        "\\.\r\n";
+    auto tokens = tokenize(sql);
+
+    assert(tokens[0].type == TokenType::MetaCommand && tokens[0].value == "\\restrict Gx3k9");
+    size_t copy = 0;
+    while (tokens[copy].type != TokenType::CopyData) ++copy;
+    assert(tokens[copy - 1].value == ";" && tokens[copy - 2].value == "stdin");
+    const Token& data = tokens[copy];
+    assert(data.value.starts_with("1\tann") && data.value.ends_with("is data too\n"));
+    assert(data.line == 8 && data.column == 1);
+    assert(tokens[copy + 1].type == TokenType::MetaCommand && tokens[copy + 1].value == "\\.");
+    assert(tokens[copy + 1].line == 11 && tokens[copy + 1].column == 1);
+    assert(tokens[copy + 2].value == "SELECT" && tokens[copy + 2].line == 12);
+    assert(tokens[copy + 5].type == TokenType::MetaCommand && tokens[copy + 5].value == "\\connect other");
+
+    // CRLF script; blanks between ';' and the line end are allowed
+    const Token& csv = tokens[tokens.size() - 2];
+    assert(csv.type == TokenType::CopyData && csv.value == "a,b\r\n" && csv.line == 15);
+    assert(tokens.back().type == TokenType::MetaCommand && tokens.back().value == "\\.");
+
+    // Statements: COPY runs through its data and "\." line
+    StatementSplitter splitter;
+    splitter.set_psql_script(true);
+    check_same(splitter, sql, tokenize(sql));
+    auto spans = splitter.split(sql);
+    assert(spans.size() == 6);
+    assert(spans[0].text(sql) == "\\restrict Gx3k9");
+    assert(spans[2].text(sql).starts_with("--\n") && spans[2].text(sql).ends_with("is data too\n\\."));
+    assert(spans[4].text(sql) == "\\connect other");
+
+    // Same spans without comments and positions
+    auto router = tokenize<RouterTokenizer>(sql);
+    assert(router[0].value == tokens[0].value);
+    size_t router_copy = 0;
+    while (router[router_copy].type != TokenType::CopyData) ++router_copy;
+    assert(router[router_copy].value.data() == data.value.data() && router[router_copy].value == data.value);
+
+    std::cout << "✅ " << tokens.size() << " tokens, data blocks and meta-commands as single spans\n";
+}
+
+void test_copy_detection() {
+    std::cout << "\n=== COPY Detection ===\n";
+
+    assert(is_copy_from_stdin("COPY t FROM stdin"));
+    assert(is_copy_from_stdin("\n-- x; y\n/* z */ copy s.t (a, \"b c\") from STDIN with (format text)"));
+    assert(!is_copy_from_stdin("COPY t TO stdout"));
+    assert(!is_copy_from_stdin("COPY t FROM '/tmp/stdin'"));
+    assert(!is_copy_from_stdin("COPY t FROM stdin_file"));
+    assert(!is_copy_from_stdin("SELECT * FROM stdin"));
+    assert(!is_copy_from_stdin("(COPY t FROM stdin"));
+
+    // Not followed by a line end: data is not entered
+    std::string_view sql = "COPY t FROM stdin; SELECT 1;\n\\.\n";
+    auto tokens = tokenize(sql);
+    for (const Token& token : tokens) {
+        assert(token.type != TokenType::CopyData);
+    }
+
+    // Missing "\." runs to the end of the input
+    sql = "COPY t FROM stdin;\n1\tx\n2\ty";
+    tokens = tokenize(sql);
+    assert(tokens.back().type == TokenType::CopyData && tokens.back().value == "1\tx\n2\ty");
+
+    // Plain mode is unchanged
+    sql = "COPY t FROM stdin;\n1\n\\.\n";
+    tokens = tokenize(sql, false);
+    for (const Token& token : tokens) {
+        assert(token.type != TokenType::CopyData && token.type != TokenType::MetaCommand);
+    }
+
+    std::cout << "✅ COPY ... FROM stdin recognized; anything else lexes as SQL\n";
+}
+
+void test_splitter() {
+    std::cout << "\n=== Splitter in psql Mode ===\n";
+
+    StatementSplitter splitter;
+    splitter.set_psql_script(true);
+
+    // Data blocks straddling block edges
+    for (size_t pad = 0; pad < 140; ++pad) {
+        std::string sql = "COPY t FROM stdin;\n" + std::string(pad, 'x') + "\n\\.\n;" + std::string(pad % 7, '\\');
+        check_same(splitter, sql, tokenize(sql));
+    }
+
+    std::mt19937 rng(49);
+    const char* pieces[] = {"COPY t FROM stdin;", "copy x from STDIN ;", "\n", "\\.", "\\", ";", "'", "\"",
+                            "--", "/*", "*/", " ", "a", "\t", "\r"};
+    for (int round = 0; round < 20000; ++round) {
+        std::string sql;
+        size_t count = rng() % 40;
+        for (size_t i = 0; i < count; ++i) {
+            sql += pieces[rng() % std::size(pieces)];
+        }
+        check_same(splitter, sql, tokenize(sql));
+    }
+
+    std::cout << "✅ 20000 random scripts match the token-level split\n";
+}
+
+int main() {
+    std::cout << "Running psql Script Tests...\n\n";
+
+    test_pg_dump();
+    test_copy_detection();
+    test_splitter();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
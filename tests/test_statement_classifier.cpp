@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <cassert>
+#include "../include/statement_classifier.hpp"
+
+using namespace db25;
+
+void test_kinds_and_targets() {
+    std::cout << "=== Kinds and Targets ===\n";
+
+    struct Case {
+        const char* sql;
+        StatementKind kind;
+        std::string_view target;
+        bool writes;
+    };
+    const Case cases[] = {
+        {"SELECT a, b FROM users WHERE id = 1", StatementKind::Select, "users", false},
+        {"select * from public.\"Orders\" o", StatementKind::Select, "public.\"Orders\"", false},
+        {"-- leading\n/* comments */ SELECT 1 FROM dual", StatementKind::Select, "dual", false},
+        {"((SELECT x FROM t1) UNION SELECT y FROM t2)", StatementKind::Select, "t1", false},
+        {"SELECT * FROM (SELECT * FROM inner_t) s", StatementKind::Select, "inner_t", false},
+        {"SELECT 1; DELETE FROM t", StatementKind::Select, "", false},
+        {"SELECT a INTO new_t FROM t", StatementKind::Select, "t", true},
+        {"VALUES (1), (2)", StatementKind::Select, "", false},
+        {"SELECT * FROM t FOR UPDATE", StatementKind::Select, "t", true},
+        {"SELECT * FROM t WHERE a = 1 FOR NO KEY UPDATE OF t SKIP LOCKED", StatementKind::Select, "t", true},
+        {"select * from t for share", StatementKind::Select, "t", true},
+        {"SELECT * FROM t FOR KEY SHARE NOWAIT", StatementKind::Select, "t", true},
+        {"SELECT * FROM (SELECT * FROM q FOR UPDATE) s", StatementKind::Select, "q", true},
+        {"SELECT 1 FOR UPDATE", StatementKind::Select, "", true},
+        {"SELECT 'for update' FROM t -- for update\n", StatementKind::Select, "t", false},
+        {"SELECT format, platform FROM t", StatementKind::Select, "t", false},
+        {"SELECT * FROM t; SELECT * FROM u FOR UPDATE", StatementKind::Select, "t", false},
+        {"INSERT INTO db.events (a, b) VALUES (1, 2)", StatementKind::Insert, "db.events", true},
+        {"INSERT OR REPLACE INTO kv VALUES (1)", StatementKind::Insert, "kv", true},
+        {"UPDATE ONLY accounts SET x = 1", StatementKind::Update, "accounts", true},
+        {"UPDATE OR IGNORE t SET x = 1", StatementKind::Update, "t", true},
+        {"DELETE FROM sessions WHERE expired", StatementKind::Delete, "sessions", true},
+        {"CREATE TABLE IF NOT EXISTS s.log (id INT)", StatementKind::Ddl, "s.log", true},
+        {"CREATE UNIQUE INDEX idx_a ON t (a)", StatementKind::Ddl, "idx_a", true},
+        {"DROP VIEW IF EXISTS v", StatementKind::Ddl, "v", true},
+        {"ALTER TABLE t ADD COLUMN c INT", StatementKind::Ddl, "t", true},
+        {"BEGIN", StatementKind::Transaction, "", false},
+        {"COMMIT;", StatementKind::Transaction, "", false},
+        {"ROLLBACK TO SAVEPOINT s1", StatementKind::Transaction, "", false},
+        {"EXPLAIN SELECT * FROM t", StatementKind::Utility, "", false},
+        {"PRAGMA journal_mode", StatementKind::Utility, "", false},
+        {"frobnicate the database", StatementKind::Unknown, "", false},
+        {"", StatementKind::Unknown, "", false},
+    };
+    for (const auto& c : cases) {
+        StatementClass result = classify_statement(c.sql);
+        assert(result.kind == c.kind);
+        assert(result.target == c.target);
+        assert(result.writes == c.writes);
+    }
+
+    StatementClass ddl = classify_statement("CREATE OR REPLACE VIEW v AS SELECT 1");
+    assert(ddl.object == Keyword::VIEW && ddl.keyword == Keyword::CREATE);
+    assert(statement_kind_name(ddl.kind) == "DDL");
+
+    std::cout << "✅ " << std::size(cases) << " statements classified\n";
+}
+
+void test_common_table_expressions() {
+    std::cout << "\n=== Common Table Expressions ===\n";
+
+    StatementClass read = classify_statement(
+        "WITH RECURSIVE r(n) AS (SELECT 1 FROM seed UNION ALL SELECT n + 1 FROM r), "
+        "s AS MATERIALIZED (SELECT (1)) SELECT * FROM totals");
+    assert(read.kind == StatementKind::Select && read.target == "totals");
+    assert(read.read_only());
+
+    StatementClass moved = classify_statement(
+        "WITH gone AS (DELETE FROM queue RETURNING *) INSERT INTO archive SELECT * FROM gone");
+    assert(moved.kind == StatementKind::Insert && moved.target == "archive");
+
+    StatementClass hidden = classify_statement(
+        "WITH x AS (UPDATE t SET a = 1 RETURNING a) SELECT * FROM x");
+    assert(hidden.kind == StatementKind::Select && hidden.writes && !hidden.read_only());
+
+    std::cout << "✅ CTEs skipped; writing CTEs mark the statement as writing\n";
+}
+
+void test_early_exit() {
+    std::cout << "\n=== Early Exit ===\n";
+
+    std::string insert = "INSERT INTO big_table (a, b) VALUES ";
+    insert.reserve(2000000);
+    for (int i = 0; i < 100000; ++i) {
+        insert.append("(").append(std::to_string(i)).append(", 'row'), ");
+    }
+    insert += "(0, 'last')";
+    StatementClass result = classify_statement(insert);
+    assert(result.kind == StatementKind::Insert && result.target == "big_table");
+    assert(result.scanned < 32);
+
+    std::string select = "SELECT * FROM t WHERE id IN (" + std::string(1 << 20, '1') + ")";
+    result = classify_statement(select);
+    assert(result.target == "t" && result.scanned < 32 && result.read_only());
+
+    // A row lock after the list is still found, at the cost of lexing it
+    std::string locking = select + " FOR UPDATE";
+    result = classify_statement(locking);
+    assert(result.target == "t" && !result.read_only() && result.scanned == locking.size());
+
+    std::cout << "✅ " << insert.size() << "-byte INSERT routed after " << classify_statement(insert).scanned
+              << " bytes\n";
+}
+
+int main() {
+    std::cout << "Running Statement Classifier Tests...\n\n";
+
+    test_kinds_and_targets();
+    test_common_table_expressions();
+    test_early_exit();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <cassert>
+#include "../include/statement_splitter.hpp"
+#include "../include/simd_tokenizer.hpp"
+#include "../include/simd_block_scan.hpp"
+#include "test_support.hpp"
+
+using namespace db25;
+using namespace db25::test;
+
+void test_block_kernels() {
+    std::cout << "=== Block Classification Kernels ===\n";
+
+    std::mt19937 rng(64);
+    constexpr std::array<uint8_t, 3> chars = {';', '\'', 0x80};
+    for (int round = 0; round < 1000; ++round) {
+        constexpr uint8_t pool[] = {';', '\'', 0x80, 'a', 'b'};
+        uint8_t block[SCAN_BLOCK_SIZE];
+        for (auto& b : block) b = pool[rng() % sizeof(pool)];
+
+        auto expected = match_block(ScalarProcessor{}, block, chars);
+        SimdDispatcher dispatcher;
+        auto actual = dispatcher.dispatch([&](auto processor) {
+            return match_block(processor, block, chars);
+        });
+        assert(actual == expected);
+    }
+
+    std::cout << "✅ " << SimdDispatcher().level_name() << " kernel matches scalar\n\n";
+}
+
+void test_edge_cases() {
+    std::cout << "=== Quote and Comment Edge Cases ===\n";
+
+    StatementSplitter splitter;
+    const char* cases[] = {
+        "",
+        ";",
+        ";;",
+        "SELECT 1; SELECT 2;",
+        "SELECT ';' ; SELECT \"a;b\";",
+        "SELECT 'it''s; fine'; SELECT 2",
+        "SELECT 1 -- comment; here\n; SELECT 2",
+        "SELECT 1 /* a ; b */ ; x",
+        "SELECT 1 /* unterminated ;",
+        "/*;",
+        "/*/;",
+        "SELECT 'unterminated ;",
+        "a - - b; c -/ d; e */ f;",
+        "SELECT '''';",
+        "-- only a comment ;",
+        "SELECT 1e--;\nSELECT 2;",          // "1e-" is a number, "--" not a comment
+        "SELECT 1.5E+--x\n; y",
+        "SELECT 2e-1e--;\n;",
+        "SELECT 1.2.3e--;\n;",
+        "SELECT x1e--;\n;",
+        "SELECT \xC3\xA9""1e--;\n;",
+        "SELECT \x80""1e--;\n;",
+    };
+    for (const char* sql : cases) {
+        check_same(splitter, sql);
+    }
+
+    // Boundaries straddling block edges
+    for (size_t pad = 55; pad < 75; ++pad) {
+        check_same(splitter, std::string(pad, ' ') + "'a'';';--x\n;/*;*/;");
+        check_same(splitter, std::string(pad, 'x') + "--;\n;");
+    }
+
+    std::cout << "✅ Edge cases match token-level split\n";
+}
+
+void test_random_inputs() {
+    std::cout << "\n=== Randomized Inputs ===\n";
+
+    StatementSplitter splitter;
+    std::mt19937 rng(25);
+    const char alphabet[] = ";'\"-/*\nab e1.+";
+    for (int round = 0; round < 20000; ++round) {
+        std::string sql(rng() % 300, ' ');
+        for (auto& ch : sql) ch = alphabet[rng() % (sizeof(alphabet) - 1)];
+        check_same(splitter, sql);
+    }
+
+    std::cout << "✅ 20000 random inputs match token-level split\n";
+}
+
+void test_corpus_spans() {
+    std::cout << "\n=== Test Corpus Spans ===\n";
+
+    std::string sql = load_corpus();
+
+    StatementSplitter splitter;
+    check_same(splitter, sql);
+
+    auto spans = splitter.split(sql);
+    assert(!spans.empty());
+    for (const auto& span : spans) {
+        auto text = span.text(sql);
+        assert(!text.empty());
+        assert(text.front() != ' ' && text.front() != '\n');
+    }
+
+    auto simple = split_statements("  SELECT 1;\n\n  SELECT 2  ");
+    assert(simple.size() == 2);
+    assert(simple[0].text("  SELECT 1;\n\n  SELECT 2  ") == "SELECT 1;");
+    assert(simple[1].text("  SELECT 1;\n\n  SELECT 2  ") == "SELECT 2  ");
+
+    std::cout << "✅ " << spans.size() << " statements in corpus\n";
+}
+
+int main() {
+    std::cout << "Running Statement Splitter Tests...\n\n";
+
+    test_block_kernels();
+    test_edge_cases();
+    test_random_inputs();
+    test_corpus_spans();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
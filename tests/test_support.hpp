@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#pragma once
+
+// Helpers shared by the unit tests: the reference serial tokenization,
+// token comparison, the test corpus and the statement splitter cross-check.
+
+#include <cassert>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../include/simd_tokenizer.hpp"
+#include "../include/statement_splitter.hpp"
+
+namespace db25::test {
+
+inline const std::byte* bytes(std::string_view s) {
+    return reinterpret_cast<const std::byte*>(s.data());
+}
+
+// One SimdTokenizer pass with the default policy and options
+inline std::vector<Token> tokenize_serial(std::string_view sql) {
+    SimdTokenizer tokenizer(bytes(sql), sql.size());
+    return tokenizer.tokenize();
+}
+
+// Same tokens over the same bytes, including the reserved flags byte
+inline void assert_same_tokens(const std::vector<Token>& a, const std::vector<Token>& b) {
+    assert(a.size() == b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        assert(a[i].type == b[i].type);
+        assert(a[i].keyword_id == b[i].keyword_id);
+        assert(a[i].reserved == b[i].reserved);
+        assert(a[i].line == b[i].line);
+        assert(a[i].column == b[i].column);
+        assert(a[i].value.data() == b[i].value.data());
+        assert(a[i].value.size() == b[i].value.size());
+    }
+}
+
+// test/sql_test.sqls; tests run from the build directory
+inline std::string load_corpus() {
+    std::ifstream file("test/sql_test.sqls");
+    assert(file && "run from the build directory");
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+// Reference statement boundaries from the tokens of `sql`: ';' tokens not
+// followed by COPY data, and the last byte of every psql meta-command
+inline std::vector<size_t> token_level_boundaries(std::string_view sql, const std::vector<Token>& tokens) {
+    std::vector<size_t> out;
+    for (size_t i = 0; i < tokens.size(); ++i) {
+        size_t offset = static_cast<size_t>(tokens[i].value.data() - sql.data());
+        if (tokens[i].type == TokenType::MetaCommand) {
+            out.push_back(offset + tokens[i].value.size() - 1);
+        } else if (tokens[i].operator_kind() == OperatorKind::Semicolon &&
+                   (i + 1 == tokens.size() || tokens[i + 1].type != TokenType::CopyData)) {
+            out.push_back(offset);
+        }
+    }
+    return out;
+}
+
+// The splitter agrees with the boundaries of `tokens`, lexed from `sql`
+inline void check_same(const StatementSplitter& splitter, std::string_view sql, const std::vector<Token>& tokens) {
+    auto simd = splitter.find_boundaries(bytes(sql), sql.size());
+    auto expected = token_level_boundaries(sql, tokens);
+    if (simd != expected) {
+        std::cerr << "Mismatch for input: [" << sql << "]\n";
+    }
+    assert(simd == expected);
+}
+
+// Same against the default tokenization
+inline void check_same(const StatementSplitter& splitter, std::string_view sql) {
+    check_same(splitter, sql, tokenize_serial(sql));
+}
+
+}  // namespace db25::test
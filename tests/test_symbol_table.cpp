@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include "../include/simd_tokenizer.hpp"
+#include "../include/symbol_table.hpp"
+
+using namespace db25;
+
+void test_case_insensitive_ids() {
+    std::cout << "=== Case-Insensitive Interning ===\n";
+
+    SymbolTable table;
+    uint32_t users = table.intern("Users");
+    assert(users == 1);
+    assert(table.intern("USERS") == users);
+    assert(table.intern("users") == users);
+    assert(table.name(users) == "Users");
+
+    uint32_t id = table.intern("user_id1");
+    assert(id == 2);
+    assert(table.intern("user_id") == 3);
+    assert(table.find("USER_ID1") == id);
+    assert(table.find("missing") == NO_SYMBOL);
+    assert(table.size() == 3);
+
+    // Folding is ASCII letters only: '_' vs DEL, '@' vs '`' stay distinct
+    assert(!symbol_equals("a_", "a\x7f"));
+    assert(!symbol_equals("a@", "a`"));
+    assert(symbol_hash("LongIdentifierName_42") == symbol_hash("longidentifiername_42"));
+
+    std::cout << "✅ Dense IDs, folded lookups, first spelling kept\n";
+}
+
+void test_growth() {
+    std::cout << "\n=== Table Growth ===\n";
+
+    SymbolTable table;
+    for (uint32_t i = 0; i < 100000; ++i) {
+        std::string name = "col";
+        name += std::to_string(i);
+        assert(table.intern(name) == i + 1);
+    }
+    for (uint32_t i = 0; i < 100000; i += 997) {
+        std::string name = "COL";
+        name += std::to_string(i);
+        assert(table.find(name) == i + 1);
+        assert(table.name(i + 1) == "col" + std::to_string(i));
+    }
+
+    std::cout << "✅ 100000 symbols across shard resizes\n";
+}
+
+void test_concurrent_interning() {
+    std::cout << "\n=== Concurrent Interning ===\n";
+
+    SymbolTable table;
+    constexpr int threads = 4;
+    constexpr uint32_t names = 20000;
+    std::vector<std::vector<uint32_t>> ids(threads, std::vector<uint32_t>(names));
+
+    // A reader never sees an ID counted by size() without its name
+    std::atomic<bool> done{false};
+    std::thread reader([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            size_t size = table.size();
+            if (size > 0) {
+                std::string_view name = table.name(static_cast<uint32_t>(size));
+                assert(!name.empty() && (name[0] == 't' || name[0] == 'T'));
+            }
+        }
+    });
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            // Each thread walks the same names in a different order and case
+            for (uint32_t k = 0; k < names; ++k) {
+                uint32_t i = (k * 7919 + t * 101) % names;
+                std::string name = (t % 2) ? "T" : "t";
+                name += std::to_string(i);
+                ids[t][i] = table.intern(name);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    assert(table.size() == names);
+    for (uint32_t i = 0; i < names; ++i) {
+        for (int t = 1; t < threads; ++t) {
+            assert(ids[t][i] == ids[0][i]);
+        }
+        assert(ids[0][i] >= 1 && ids[0][i] <= names);
+    }
+
+    std::cout << "✅ All threads agree on " << table.size() << " IDs\n";
+}
+
+void test_tokenizer_interning() {
+    std::cout << "\n=== Tokenizer Interning ===\n";
+
+    SymbolTable table;
+    std::string first = "SELECT Name, id FROM Users WHERE users.ID = 1";
+    std::string second = "select NAME from USERS";
+
+    SimdTokenizer a(reinterpret_cast<const std::byte*>(first.data()), first.size());
+    a.set_symbol_table(&table);
+    auto tokens = a.tokenize();
+
+    SimdTokenizer b(reinterpret_cast<const std::byte*>(second.data()), second.size());
+    b.set_symbol_table(&table);
+    auto other = b.tokenize();
+
+    for (const auto& token : tokens) {
+        assert((token.symbol_id != NO_SYMBOL) == (token.type == TokenType::Identifier));
+        if (token.symbol_id != NO_SYMBOL) {
+            assert(symbol_equals(table.name(token.symbol_id), token.value));
+        }
+    }
+
+    // Name resolution by integer comparison, across queries
+    auto id_of = [](const std::vector<Token>& list, std::string_view text) {
+        for (const auto& token : list) {
+            if (symbol_equals(token.value, text)) return token.symbol_id;
+        }
+        return NO_SYMBOL;
+    };
+    assert(id_of(tokens, "users") == id_of(other, "users"));
+    assert(id_of(tokens, "name") == id_of(other, "name"));
+    assert(id_of(tokens, "id") != id_of(tokens, "users"));
+
+    // Without a table nothing is interned
+    SimdTokenizer plain(reinterpret_cast<const std::byte*>(first.data()), first.size());
+    for (const auto& token : plain.tokenize()) {
+        assert(token.symbol_id == NO_SYMBOL);
+    }
+
+    std::cout << "✅ Identifier tokens carry shared symbol IDs\n";
+}
+
+int main() {
+    std::cout << "Running Symbol Table Tests...\n\n";
+
+    test_case_insensitive_ids();
+    test_growth();
+    test_concurrent_interning();
+    test_tokenizer_interning();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
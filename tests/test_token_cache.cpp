@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <cstddef>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cassert>
+#include "../include/token_cache.hpp"
+#include "test_support.hpp"
+
+using namespace db25;
+using namespace db25::test;
+
+void test_checksum_vectors() {
+    std::cout << "=== Source Checksum ===\n";
+
+    // Reference XXH64 values (seed 0)
+    assert(source_checksum(nullptr, 0) == 0xEF46DB3751D8E999ULL);
+    std::string abc = "abc";
+    assert(source_checksum(bytes(abc), abc.size()) == 0x44BC2CF5AD770999ULL);
+
+    std::string text(1000, 'x');
+    uint64_t before = source_checksum(bytes(text), text.size());
+    text[517] = 'y';
+    assert(source_checksum(bytes(text), text.size()) != before);
+
+    std::cout << "✅ Checksum matches XXH64 and detects edits\n";
+}
+
+void test_round_trip() {
+    std::cout << "\n=== Write / Map / Materialize ===\n";
+
+    std::string sql;
+    for (int i = 0; i < 2000; ++i) {
+        sql += "SELECT a.id, 'it''s' AS s FROM t a -- note\nWHERE a.x >= ";
+        sql += std::to_string(i);
+        sql += " /* block */;\n";
+    }
+    auto expected = tokenize_serial(sql);
+    auto path = std::filesystem::temp_directory_path() / "db25_test_cache.tokc";
+
+    write_token_cache(path, bytes(sql), sql.size(), expected);
+    assert(std::filesystem::file_size(path) ==
+           sizeof(TokenCacheHeader) + expected.size() * sizeof(TokenRecord));
+
+    TokenCache cache(path);
+    assert(cache.status() == CacheStatus::Valid);
+    assert(cache.validate(bytes(sql), sql.size()) == CacheStatus::Valid);
+    assert(cache.records().size() == expected.size());
+    assert(cache.records()[0].offset == 0 && cache.records()[0].length == 6);
+    assert(cache.records()[0].keyword_id == Keyword::SELECT);
+
+    assert_same_tokens(expected, cache.materialize(bytes(sql)));
+
+    std::filesystem::remove(path);
+    std::cout << "Cached " << expected.size() << " tokens\n";
+    std::cout << "✅ Mapped cache reproduces tokenize() output\n";
+}
+
+void test_fallback_paths() {
+    std::cout << "\n=== Validation and Fallback ===\n";
+
+    std::string sql = "SELECT * FROM users WHERE id = 1;";
+    auto path = std::filesystem::temp_directory_path() / "db25_test_fallback.tokc";
+    std::filesystem::remove(path);
+
+    // Missing cache: tokenize and write it
+    auto first = load_or_tokenize(path, bytes(sql), sql.size());
+    assert(first.status == CacheStatus::Missing && !first.from_cache());
+    assert_same_tokens(tokenize_serial(sql), first.tokens);
+    assert(std::filesystem::exists(path));
+
+    // Unchanged source: served from the cache
+    auto second = load_or_tokenize(path, bytes(sql), sql.size());
+    assert(second.from_cache());
+    assert_same_tokens(first.tokens, second.tokens);
+
+    // Same size, different bytes: checksum catches it
+    std::string edited = sql;
+    edited[edited.find('1')] = '2';
+    auto third = load_or_tokenize(path, bytes(edited), edited.size(), false);
+    assert(third.status == CacheStatus::SourceChanged);
+    assert_same_tokens(tokenize_serial(edited), third.tokens);
+    assert(TokenCache(path).validate(bytes(sql), sql.size()) == CacheStatus::Valid);
+
+    // A record pointing past the source, checksum intact
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        uint64_t offset = sql.size() - 1;
+        uint32_t length = 2;
+        file.seekp(sizeof(TokenCacheHeader) + offsetof(TokenRecord, offset));
+        file.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    }
+    assert(TokenCache(path).status() == CacheStatus::Corrupt);
+    assert(TokenCache(path).records().empty());
+    auto flipped = load_or_tokenize(path, bytes(sql), sql.size(), false);
+    assert(flipped.status == CacheStatus::Corrupt);
+    assert_same_tokens(tokenize_serial(sql), flipped.tokens);
+
+    // Truncated and foreign files
+    std::filesystem::resize_file(path, sizeof(TokenCacheHeader) + 5);
+    assert(TokenCache(path).status() == CacheStatus::Corrupt);
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << std::string(200, 'z');
+    assert(TokenCache(path).status() == CacheStatus::Corrupt);
+
+    auto fourth = load_or_tokenize(path, bytes(sql), sql.size());
+    assert(fourth.status == CacheStatus::Corrupt);
+    assert(TokenCache(path).status() == CacheStatus::Valid);
+
+    std::filesystem::remove(path);
+    std::cout << "✅ Stale, corrupt and missing caches fall back to SimdTokenizer\n";
+}
+
+int main() {
+    std::cout << "Running Token Cache Tests...\n\n";
+
+    test_checksum_vectors();
+    test_round_trip();
+    test_fallback_paths();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <random>
+#include <stdexcept>
+#include <cassert>
+#include "../include/token_codec.hpp"
+#include "test_support.hpp"
+
+using namespace db25;
+using namespace db25::test;
+
+// Encodes, decodes and returns the encoded size
+static size_t round_trip(const std::string& sql) {
+    auto tokens = tokenize_serial(sql);
+    auto encoded = encode_tokens(bytes(sql), sql.size(), tokens);
+    TokenDecoder decoder(encoded, bytes(sql), sql.size());
+    assert(decoder.token_count() == tokens.size());
+    assert_same_tokens(tokens, decoder.decode());
+    return encoded.size();
+}
+
+void test_edge_cases() {
+    std::cout << "=== Edge Cases ===\n";
+
+    const char* cases[] = {
+        "",
+        "   \n\t ",
+        "SELECT",
+        "-- trailing comment\n",
+        "SELECT 'multi\nline' , \"q\"\"x\" FROM t;",
+        "/* unterminated\n\n",
+        "'unterminated   \n  ",
+        "a=1 AND b<>2 OR c::int || d >= 3.5e-2 -- c\r\nx",
+        "SELECT\r\n  a\r\n",
+    };
+    for (const char* sql : cases) {
+        round_trip(sql);
+    }
+
+    // Large gaps need the varint delta escape
+    std::string gaps = "SELECT" + std::string(100000, ' ') + "x" + std::string(20, '\n') + "y";
+    round_trip(gaps);
+
+    std::cout << "✅ Edge cases round-trip\n";
+}
+
+void test_random_inputs() {
+    std::cout << "\n=== Randomized Inputs ===\n";
+
+    std::mt19937 rng(32);
+    const char* words[] = {"SELECT", "from", "x1", "42", "3.5", "'s''q'", "\"id\"", ";", ",",
+                           "(", ")", "<=", "::", "-- c\n", "/* b\n */", " ", "\n", "\t", "\r\n", "'n\nl'"};
+    for (int round = 0; round < 2000; ++round) {
+        std::string sql;
+        size_t count = rng() % 3000;
+        for (size_t i = 0; i < count; ++i) {
+            sql += words[rng() % std::size(words)];
+        }
+        round_trip(sql);
+    }
+
+    std::cout << "✅ 2000 random inputs round-trip across block boundaries\n";
+}
+
+void test_corpus_density() {
+    std::cout << "\n=== Test Corpus Density ===\n";
+
+    std::string sql = load_corpus();
+
+    auto tokens = tokenize_serial(sql);
+    size_t encoded = round_trip(sql);
+    double per_token = double(encoded) / tokens.size();
+    assert(per_token <= 5.0);
+
+    std::cout << tokens.size() << " tokens -> " << encoded << " bytes ("
+              << per_token << " bytes/token)\n";
+    std::cout << "✅ Corpus encodes within 5 bytes per token\n";
+}
+
+void test_random_access_and_flags() {
+    std::cout << "\n=== Random Access and Flags ===\n";
+
+    std::string sql;
+    for (int i = 0; i < 3000; ++i) {
+        sql += "SELECT c";
+        sql += std::to_string(i);
+        sql += " FROM t WHERE x IS NOT NULL;\n";
+    }
+    auto tokens = tokenize_serial(sql);
+    tokens[1500].reserved = 7;
+
+    auto encoded = encode_tokens(bytes(sql), sql.size(), tokens);
+    TokenDecoder decoder(encoded, bytes(sql), sql.size());
+    assert(decoder.block_count() == (tokens.size() + CODEC_BLOCK_TOKENS - 1) / CODEC_BLOCK_TOKENS);
+
+    for (size_t index : {size_t(0), size_t(1023), size_t(1024), size_t(1500), tokens.size() - 1}) {
+        Token token = decoder.at(index);
+        assert(token.value.data() == tokens[index].value.data());
+        assert(token.value == tokens[index].value);
+        assert(token.line == tokens[index].line);
+        assert(token.reserved == tokens[index].reserved);
+    }
+    assert_same_tokens(tokens, decoder.decode());
+
+    std::cout << "✅ Blocks decode independently\n";
+}
+
+void test_rejects_bad_input() {
+    std::cout << "\n=== Rejects Bad Input ===\n";
+
+    std::string sql = "SELECT a FROM t;";
+    auto tokens = tokenize_serial(sql);
+
+    // Token that is not where the source says it is
+    auto shifted = tokens;
+    shifted[1].column += 1;
+    bool threw = false;
+    try {
+        (void)encode_tokens(bytes(sql), sql.size(), shifted);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    auto encoded = encode_tokens(bytes(sql), sql.size(), tokens);
+    encoded[0] = 'X';
+    threw = false;
+    try {
+        TokenDecoder decoder(encoded, bytes(sql), sql.size());
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Truncated stream is reported, not read past
+    encoded = encode_tokens(bytes(sql), sql.size(), tokens);
+    encoded.resize(encoded.size() - 3);
+    threw = false;
+    try {
+        TokenDecoder decoder(encoded, bytes(sql), sql.size());
+        (void)decoder.decode();
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Type nibble past the last TokenType
+    encoded = encode_tokens(bytes(sql), sql.size(), tokens);
+    size_t block = sizeof(CodecHeader) + sizeof(CodecBlock);
+    size_t first_header = block + 1 + encoded[block] * 2 + 1;
+    assert(static_cast<TokenType>(encoded[first_header] & 0x0F) == TokenType::Keyword);
+    encoded[first_header] |= 0x0F;
+    threw = false;
+    try {
+        TokenDecoder decoder(encoded, bytes(sql), sql.size());
+        (void)decoder.decode();
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✅ Mismatched tokens and corrupt buffers throw\n";
+}
+
+int main() {
+    std::cout << "Running Token Codec Tests...\n\n";
+
+    test_edge_cases();
+    test_random_inputs();
+    test_corpus_density();
+    test_random_access_and_flags();
+    test_rejects_bad_input();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <thread>
+#include <cassert>
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "../include/token_generator.hpp"
+
+using namespace db25;
+
+static const std::string SQL =
+    "SELECT id, name FROM users -- trailing\nWHERE age >= 21 AND name <> 'x';";
+
+void test_generator_matches_tokenize() {
+    std::cout << "=== Generator vs tokenize() ===\n";
+
+    SimdTokenizer reference(reinterpret_cast<const std::byte*>(SQL.data()), SQL.size());
+    auto expected = reference.tokenize();
+
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(SQL.data()), SQL.size());
+    InlineFrameArena<512> arena;
+
+    size_t i = 0;
+    for (const Token& token : generate_tokens(arena, tokenizer)) {
+        assert(i < expected.size());
+        assert(token.type == expected[i].type);
+        assert(token.keyword_id == expected[i].keyword_id);
+        assert(token.value == expected[i].value);
+        assert(token.line == expected[i].line);
+        assert(token.column == expected[i].column);
+        ++i;
+    }
+    assert(i == expected.size());
+    assert(arena.used() == 0);
+
+    std::cout << "✅ " << i << " tokens yielded, arena rewound\n";
+}
+
+void test_interleaved_generators() {
+    std::cout << "\n=== Interleaved Generators ===\n";
+
+    std::string other = "INSERT INTO t VALUES (1, 2)";
+    SimdTokenizer a(reinterpret_cast<const std::byte*>(SQL.data()), SQL.size());
+    SimdTokenizer b(reinterpret_cast<const std::byte*>(other.data()), other.size());
+
+    auto gen_a = generate_tokens(a);
+    auto gen_b = generate_tokens(b);
+    assert(thread_frame_arena().used() > 0);
+
+    Token ta, tb;
+    assert(gen_a.next(ta) && ta.keyword_id == Keyword::SELECT);
+    assert(gen_b.next(tb) && tb.keyword_id == Keyword::INSERT);
+    assert(gen_a.next(ta) && ta.value == "id");
+    assert(gen_b.next(tb) && tb.keyword_id == Keyword::INTO);
+
+    size_t remaining = 0;
+    while (gen_b.next(tb)) ++remaining;
+    assert(remaining == 7);
+    assert(!gen_b.next(tb));
+
+    std::cout << "✅ Generators progress independently\n";
+}
+
+void test_arena_exhaustion() {
+    std::cout << "\n=== Arena Exhaustion ===\n";
+
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(SQL.data()), SQL.size());
+    InlineFrameArena<16> tiny;
+
+    bool threw = false;
+    try {
+        auto gen = generate_tokens(tiny, tokenizer);
+    } catch (const std::bad_alloc&) {
+        threw = true;
+    }
+    assert(threw);
+
+    std::cout << "✅ Undersized arena reported with std::bad_alloc\n";
+}
+
+void test_thread_affinity() {
+    std::cout << "\n=== Thread Affinity ===\n";
+
+    FrameArena& mine = thread_frame_arena();
+    assert(mine.usable_from_current_thread());
+
+    bool foreign_usable = true;
+    bool own_usable = false;
+    std::thread([&] {
+        foreign_usable = mine.usable_from_current_thread();
+        own_usable = thread_frame_arena().usable_from_current_thread();
+    }).join();
+    assert(!foreign_usable && own_usable);
+
+    // Caller-supplied arenas are unbound until bound explicitly
+    InlineFrameArena<64> shared;
+    std::thread([&] { foreign_usable = shared.usable_from_current_thread(); }).join();
+    assert(foreign_usable);
+
+    // Resuming on another thread terminates, with or without NDEBUG
+    pid_t child = ::fork();
+    assert(child >= 0);
+    if (child == 0) {
+        SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(SQL.data()), SQL.size());
+        TokenGenerator gen = generate_tokens(tokenizer);
+        std::thread([&] {
+            Token token;
+            (void)gen.next(token);
+        }).join();
+        ::_exit(0);
+    }
+    int status = 0;
+    assert(::waitpid(child, &status, 0) == child);
+    assert(WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT);
+
+    std::cout << "✅ Per-thread arena bound to its thread; foreign resume terminates\n";
+}
+
+int main() {
+    std::cout << "Running Token Generator Tests...\n\n";
+
+    test_generator_matches_tokenize();
+    test_interleaved_generators();
+    test_arena_exhaustion();
+    test_thread_affinity();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
@@ -34,11 +34,13 @@ void validate_token_structure() {
     std::cout << "  keyword_id: " << offsetof(Token, keyword_id) << " bytes\n";
     std::cout << "  line:       " << offsetof(Token, line) << " bytes\n";
     std::cout << "  column:     " << offsetof(Token, column) << " bytes\n";
+    std::cout << "  symbol_id:  " << offsetof(Token, symbol_id) << " bytes\n";
     std::cout << "  value:      " << offsetof(Token, value) << " bytes\n";
     
     // Verify string_view is 8-byte aligned for performance
     assert(offsetof(Token, value) % 8 == 0 && "string_view must be 8-byte aligned");
     assert(offsetof(Token, value) == 16 && "string_view should be at offset 16");
+    assert(offsetof(Token, symbol_id) == 12 && "symbol_id should reuse the former padding");
     
     std::cout << "\n✅ Token structure is properly packed!\n";
 }
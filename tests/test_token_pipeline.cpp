@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <cassert>
+#include "../include/token_pipeline.hpp"
+#include "test_support.hpp"
+
+using namespace db25;
+using namespace db25::test;
+
+void test_ring_wraparound() {
+    std::cout << "=== SPSC Ring Wraparound ===\n";
+
+    SpscTokenRing ring(3);
+    assert(ring.capacity() == 4);
+
+    for (uint32_t round = 0; round < 10; ++round) {
+        TokenBlock& block = ring.acquire_write();
+        block.count = round;
+        ring.publish();
+
+        const TokenBlock& read = ring.acquire_read();
+        assert(read.count == round);
+        ring.release();
+    }
+
+    std::cout << "✅ Ring indices wrap correctly\n";
+}
+
+void test_pipeline_matches_tokenize() {
+    std::cout << "\n=== Pipeline vs tokenize() ===\n";
+
+    std::string sql;
+    for (int i = 0; i < 5000; ++i) {
+        sql += "SELECT a.id, 'it''s' AS s, 3.5e-2 FROM t" + std::to_string(i) +
+               " a -- note\nWHERE a.x >= 10 /* block */;\n";
+    }
+
+    auto expected = tokenize_serial(sql);
+
+    // Tiny ring forces the producer to block on backpressure
+    TokenPipeline pipeline(reinterpret_cast<const std::byte*>(sql.data()), sql.size(), 2);
+    std::vector<Token> streamed;
+    Token token;
+    while (pipeline.next(token)) {
+        streamed.push_back(token);
+    }
+
+    assert_same_tokens(expected, streamed);
+    std::cout << "Streamed " << streamed.size() << " tokens\n";
+    std::cout << "✅ Pipeline output identical to tokenize()\n";
+}
+
+void test_block_interface() {
+    std::cout << "\n=== Block Interface ===\n";
+
+    std::string sql = "SELECT 1";
+    TokenPipeline pipeline(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+
+    auto block = pipeline.next_block();
+    assert(block.size() == 2);
+    assert(block[0].keyword_id == Keyword::SELECT);
+    assert(pipeline.next_block().empty());
+    assert(pipeline.next_block().empty());
+
+    std::string empty;
+    TokenPipeline empty_pipeline(reinterpret_cast<const std::byte*>(empty.data()), 0);
+    assert(empty_pipeline.next_block().empty());
+
+    std::cout << "✅ Blocks delivered and end of stream reported\n";
+}
+
+void test_early_abandon() {
+    std::cout << "\n=== Consumer Abandons Stream ===\n";
+
+    std::string sql(1 << 20, 'x');
+    for (size_t i = 0; i < sql.size(); i += 4) sql[i] = ' ';
+
+    {
+        TokenPipeline pipeline(reinterpret_cast<const std::byte*>(sql.data()), sql.size(), 2);
+        Token token;
+        assert(pipeline.next(token));
+        assert(token.type == TokenType::Identifier);
+    }
+
+    std::cout << "✅ Producer stopped and joined cleanly\n";
+}
+
+int main() {
+    std::cout << "Running Token Pipeline Tests...\n\n";
+
+    test_ring_wraparound();
+    test_pipeline_matches_tokenize();
+    test_block_interface();
+    test_early_abandon();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
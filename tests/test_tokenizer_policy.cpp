@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <cassert>
+#include "../include/simd_tokenizer.hpp"
+#include "test_support.hpp"
+
+using namespace db25;
+using namespace db25::test;
+
+template<typename Policy>
+static std::vector<Token> lex(const std::string& sql) {
+    BasicSimdTokenizer<Policy> tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    return tokenizer.tokenize();
+}
+
+// The corpus plus comments, to exercise comment positions
+static std::string corpus_with_comments() {
+    return load_corpus() + "\nSELECT a -- trailing\n, b /* block\ncomment */ FROM t;";
+}
+
+static bool same_text(const Token& a, const Token& b) {
+    return a.type == b.type && a.keyword_id == b.keyword_id &&
+           a.value.data() == b.value.data() && a.value.size() == b.value.size();
+}
+
+void test_comments() {
+    std::cout << "=== EmitComments ===\n";
+
+    std::string sql = corpus_with_comments();
+    auto full = lex<DefaultTokenizerPolicy>(sql);
+    auto skipped = lex<TokenizerPolicy<false>>(sql);
+
+    std::vector<Token> expected;
+    size_t comments = 0;
+    for (const auto& token : full) {
+        if (token.type == TokenType::Comment) {
+            ++comments;
+        } else {
+            expected.push_back(token);
+        }
+    }
+    assert(comments > 0);
+    assert(skipped.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        assert(same_text(skipped[i], expected[i]));
+        assert(skipped[i].line == expected[i].line && skipped[i].column == expected[i].column);
+    }
+
+    // Side channel indices count emitted tokens only
+    std::string numbers = "SELECT 1, /* 2 */ 3 -- 4\n, 5";
+    std::vector<NumericValue> values;
+    BasicSimdTokenizer<TokenizerPolicy<false>> tokenizer(
+        reinterpret_cast<const std::byte*>(numbers.data()), numbers.size());
+    tokenizer.set_numeric_output(&values);
+    auto tokens = tokenizer.tokenize();
+    assert(values.size() == 3);
+    for (const auto& value : values) {
+        assert(tokens[value.token_index].type == TokenType::Number);
+    }
+
+    std::cout << "✅ " << comments << " comments skipped, remaining tokens unchanged\n";
+}
+
+void test_positions() {
+    std::cout << "\n=== TrackPositions ===\n";
+
+    std::string sql = corpus_with_comments();
+    auto full = lex<DefaultTokenizerPolicy>(sql);
+    auto untracked = lex<TokenizerPolicy<true, false>>(sql);
+
+    assert(untracked.size() == full.size());
+    for (size_t i = 0; i < full.size(); ++i) {
+        assert(same_text(untracked[i], full[i]));
+        assert(untracked[i].line == 0 && untracked[i].column == 0);
+    }
+
+    std::cout << "✅ " << full.size() << " tokens identical apart from line/column\n";
+}
+
+void test_keyword_modes() {
+    std::cout << "\n=== KeywordMode ===\n";
+
+    std::string sql = corpus_with_comments();
+    auto full = lex<DefaultTokenizerPolicy>(sql);
+    auto lookup = lex<TokenizerPolicy<true, true, KeywordMode::Lookup>>(sql);
+    auto none = lex<TokenizerPolicy<true, true, KeywordMode::None>>(sql);
+
+    assert(lookup.size() == full.size() && none.size() == full.size());
+    size_t keywords = 0;
+    for (size_t i = 0; i < full.size(); ++i) {
+        assert(same_text(lookup[i], full[i]));
+        if (full[i].type == TokenType::Keyword) {
+            ++keywords;
+            assert(none[i].type == TokenType::Identifier);
+            assert(none[i].keyword_id == Keyword::UNKNOWN);
+            assert(none[i].value.data() == full[i].value.data());
+        } else {
+            assert(same_text(none[i], full[i]));
+        }
+    }
+    assert(keywords > 0);
+
+    std::cout << "✅ Lookup matches Full; None reports " << keywords << " keywords as identifiers\n";
+}
+
+void test_router() {
+    std::cout << "\n=== Router Policy ===\n";
+
+    std::string sql = "  -- route me\nINSERT /* hint */ INTO t VALUES (1, 'x');";
+    auto tokens = lex<RouterTokenizerPolicy>(sql);
+    assert(tokens.size() == 10);
+    assert(tokens[0].keyword_id == Keyword::INSERT);
+    assert(tokens[0].line == 0 && tokens[0].column == 0);
+    assert(tokens[1].keyword_id == Keyword::INTO);
+    assert(tokens.back().value == ";");
+
+    std::cout << "✅ Router tokenizer drops comments and positions\n";
+}
+
+int main() {
+    std::cout << "Running Tokenizer Policy Tests...\n\n";
+
+    test_comments();
+    test_positions();
+    test_keyword_modes();
+    test_router();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+#include <iostream>
+#include <string>
+#include <random>
+#include <cassert>
+#include "../include/simd_tokenizer.hpp"
+#include "../include/utf8.hpp"
+
+using namespace db25;
+
+static size_t reference(const std::string& s) {
+    return utf8_detail::validate_scalar(reinterpret_cast<const uint8_t*>(s.data()), s.size(), 0);
+}
+
+// Every compiled validator must agree with the scalar decoder
+static void check_all_levels(const std::string& s) {
+    const auto* data = reinterpret_cast<const uint8_t*>(s.data());
+    const size_t expected = reference(s);
+    assert(validate_utf8(ScalarProcessor{}, data, s.size()) == expected);
+#if defined(__SSE4_2__)
+    assert(validate_utf8(SSE42Processor{}, data, s.size()) == expected);
+#endif
+#if defined(__AVX2__)
+    assert(validate_utf8(AVX2Processor{}, data, s.size()) == expected);
+#endif
+#if defined(__AVX512BW__)
+    assert(validate_utf8(AVX512Processor{}, data, s.size()) == expected);
+#endif
+    assert(validate_utf8(reinterpret_cast<const std::byte*>(s.data()), s.size()) == expected);
+}
+
+static void append_code_point(std::string& out, uint32_t cp) {
+    if (cp < 0x80) {
+        out += static_cast<char>(cp);
+    } else if (cp < 0x800) {
+        out += static_cast<char>(0xC0 | (cp >> 6));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out += static_cast<char>(0xE0 | (cp >> 12));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (cp >> 18));
+        out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (cp & 0x3F));
+    }
+}
+
+void test_known_sequences() {
+    std::cout << "=== Known Sequences ===\n";
+
+    struct Case { const char* text; size_t invalid_at; };
+    const Case cases[] = {
+        {"plain ascii", 11},
+        {"caf\xC3\xA9", 5},
+        {"\xE2\x82\xAC 10", 6},                 // Euro sign
+        {"\xF0\x9F\x98\x80", 4},                // U+1F600
+        {"a\xC0\x80", 1},                       // Overlong 2-byte
+        {"a\xE0\x80\x80", 1},                   // Overlong 3-byte
+        {"a\xF0\x80\x80\x80", 1},               // Overlong 4-byte
+        {"ab\xED\xA0\x80", 2},                  // Surrogate
+        {"\xF4\x90\x80\x80", 0},                // Above U+10FFFF
+        {"x\xF5\x80\x80\x80", 1},
+        {"x\x80", 1},                           // Stray continuation
+        {"x\xC3", 1},                           // Truncated at end
+        {"x\xE2\x82", 1},
+        {"\xC3\xA9\xC3", 2},
+    };
+    for (const auto& c : cases) {
+        std::string s(c.text);
+        assert(reference(s) == c.invalid_at);
+        check_all_levels(s);
+
+        // Same sequence straddling a 64-byte block boundary
+        std::string shifted = std::string(62, ' ') + s + std::string(70, 'x');
+        check_all_levels(shifted);
+        // ... and at the very end of a block-aligned input
+        std::string aligned = std::string(64 - (s.size() % 64), ' ') + s;
+        check_all_levels(aligned);
+    }
+
+    std::cout << "✅ Overlongs, surrogates, truncation and range errors located\n";
+}
+
+void test_random_against_scalar() {
+    std::cout << "\n=== Randomized vs Scalar ===\n";
+
+    std::mt19937 rng(35);
+    for (int round = 0; round < 20000; ++round) {
+        std::string s;
+        size_t length = rng() % 400;
+        while (s.size() < length) {
+            switch (rng() % 6) {
+                case 0: append_code_point(s, 0x80 + rng() % 0x780); break;
+                case 1: append_code_point(s, 0x800 + rng() % 0xF800); break;
+                case 2: append_code_point(s, 0x10000 + rng() % 0x100000); break;
+                default: s += static_cast<char>('a' + rng() % 26); break;
+            }
+        }
+        // Valid surrogate code points are not valid UTF-8; corrupt some inputs on purpose
+        if (rng() % 3 == 0 && !s.empty()) {
+            s[rng() % s.size()] = static_cast<char>(rng() % 256);
+        }
+        check_all_levels(s);
+    }
+
+    std::cout << "✅ 20000 mixed inputs agree across SIMD levels\n";
+}
+
+void test_unicode_identifiers() {
+    std::cout << "\n=== Unicode Identifiers ===\n";
+
+    std::string sql = "SELECT stra\xC3\x9F" "e, caf\xC3\xA9_2, \xE6\x97\xA5\xE6\x9C\xAC FROM gr\xC3\xB6\xC3\x9F" "e WHERE x = 1";
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    auto tokens = tokenizer.tokenize();
+
+    std::vector<std::string_view> identifiers;
+    for (const auto& token : tokens) {
+        assert(token.type != TokenType::Unknown);
+        if (token.type == TokenType::Identifier) identifiers.push_back(token.value);
+    }
+    assert(identifiers.size() == 5);
+    assert(identifiers[0] == "stra\xC3\x9F" "e");
+    assert(identifiers[1] == "caf\xC3\xA9_2");
+    assert(identifiers[2] == "\xE6\x97\xA5\xE6\x9C\xAC");
+    assert(identifiers[3] == "gr\xC3\xB6\xC3\x9F" "e");
+    assert(tokenizer.utf8_error_offset() == sql.size());
+
+    // Columns stay byte-based: "e" after the 2-byte sharp s
+    assert(tokens[1].column == 8);
+    assert(tokens[2].column == 8 + 7);
+
+    std::cout << "✅ Multi-byte characters lex as identifier characters\n";
+}
+
+void test_invalid_bytes() {
+    std::cout << "\n=== Invalid Bytes ===\n";
+
+    std::string sql = "SELECT ab\xFF" "cd, \xC3 x, \xE2\x82;";
+    SimdTokenizer tokenizer(reinterpret_cast<const std::byte*>(sql.data()), sql.size());
+    auto tokens = tokenizer.tokenize();
+
+    std::vector<std::string_view> values;
+    for (const auto& token : tokens) values.push_back(token.value);
+    assert(tokens[1].value == "ab" && tokens[1].type == TokenType::Identifier);
+    assert(tokens[2].value == "\xFF" && tokens[2].type == TokenType::Unknown);
+    assert(tokens[3].value == "cd");
+    assert(tokens[5].value == "\xC3" && tokens[5].type == TokenType::Unknown);
+    assert(tokens[8].type == TokenType::Unknown && tokens[9].type == TokenType::Unknown);
+    assert(tokens.back().value == ";");
+    assert(tokenizer.utf8_error_offset() == 9);
+
+    // Large ASCII input with a late error: chunked validation still finds it
+    std::string big(20000, 'a');
+    for (size_t i = 7; i < big.size(); i += 8) big[i] = ' ';
+    big[15000] = '\x80';
+    SimdTokenizer late(reinterpret_cast<const std::byte*>(big.data()), big.size());
+    size_t unknown = 0;
+    for (const auto& token : late.tokenize()) unknown += token.type == TokenType::Unknown;
+    assert(unknown == 1);
+    assert(late.utf8_error_offset() == 15000);
+
+    std::cout << "✅ Invalid bytes become single-byte Unknown tokens\n";
+}
+
+int main() {
+    std::cout << "Running UTF-8 Tests...\n\n";
+
+    test_known_sequences();
+    test_random_against_scalar();
+    test_unicode_identifiers();
+    test_invalid_bytes();
+
+    std::cout << "\n=== All Tests Passed! ===\n";
+    return 0;
+}
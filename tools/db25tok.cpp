@@ -0,0 +1,531 @@
+/*
+ * Copyright (c) 2024 Chiradip Mandal
+ * Author: Chiradip Mandal
+ * Organization: Space-RF.org
+ *
+ * This file is part of DB25 SQL Tokenizer.
+ *
+ * Licensed under the MIT License. See LICENSE file for details.
+ */
+
+// db25tok - command-line SQL tokenizer
+// ====================================
+// Tokenizes files (memory-mapped) or stdin with parallel workers. Large
+// inputs are cut into chunks at top-level ';' boundaries (StatementSplitter)
+// so every chunk lexes independently; results are written in input order.
+//
+// Output formats:
+//   ndjson   one JSON object per token
+//   counts   one JSON object per statement (tokens, bytes, first line)
+//   binary   token cache file per input (token_cache.hpp, mmap-able)
+//   none     tokenize only (with --summary: throughput measurement)
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "simd_tokenizer.hpp"
+#include "mapped_file.hpp"
+#include "statement_splitter.hpp"
+#include "token_cache.hpp"
+
+using namespace db25;
+namespace fs = std::filesystem;
+
+namespace {
+
+enum class Format { Ndjson, Counts, Binary, None };
+
+struct Options {
+    Format format = Format::Ndjson;
+    std::string output;                 // ndjson/counts file, or binary dump path/directory
+    unsigned jobs = 0;                  // 0 = hardware concurrency
+    size_t chunk_size = 4 << 20;        // Target bytes per parallel chunk
+    bool summary = false;
+    bool comments = true;
+    bool compound_keywords = false;
+    bool psql_script = false;
+    bool dollar_quotes = false;
+    std::vector<std::string> inputs;    // Empty or "-" = stdin
+};
+
+void usage(std::ostream& out) {
+    out << "Usage: db25tok [options] [file ...]\n"
+           "Tokenizes SQL files (or stdin when no file or '-' is given).\n\n"
+           "Options:\n"
+           "  -f, --format FMT      ndjson (default), counts, binary, none\n"
+           "  -o, --output PATH     Output file (default stdout). For binary: the dump\n"
+           "                        file, or a directory when there are several inputs\n"
+           "                        (default: <input>.db25tok next to each input)\n"
+           "  -j, --jobs N          Worker threads, 0-1024 (default 0: hardware concurrency)\n"
+           "      --chunk-size MB   Bytes per parallel chunk of a large input (default 4)\n"
+           "      --no-comments     Skip comment tokens\n"
+           "      --compound        Fuse compound keywords (ORDER BY, IS NOT NULL, ...)\n"
+           "      --psql            psql script (pg_dump): COPY data blocks and\n"
+           "                        backslash meta-commands as single tokens\n"
+           "      --dollar-quotes   $$ ... $$ / $tag$ ... $tag$ bodies as single tokens\n"
+           "  -s, --summary         Throughput summary on stderr\n"
+           "  -h, --help            Show this help\n";
+}
+
+// Whole number in [min, max]; anything else (signs, suffixes, overflow) is
+// reported and rejected
+std::optional<size_t> parse_count(const std::string& arg, std::string_view text, size_t min, size_t max) {
+    size_t count = 0;
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), count);
+    if (error != std::errc() || end != text.data() + text.size() || count < min || count > max) {
+        std::cerr << "db25tok: invalid value '" << text << "' for " << arg
+                  << " (expected " << min << ".." << max << ")\n";
+        return std::nullopt;
+    }
+    return count;
+}
+
+std::optional<Options> parse_options(int argc, char* argv[]) {
+    constexpr size_t MAX_JOBS = 1024;
+    constexpr size_t MAX_CHUNK_MB = std::numeric_limits<size_t>::max() >> 20;
+    Options options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&]() -> std::optional<std::string> {
+            if (i + 1 >= argc) {
+                std::cerr << "db25tok: " << arg << " needs a value\n";
+                return std::nullopt;
+            }
+            return std::string(argv[++i]);
+        };
+
+        if (arg == "-h" || arg == "--help") {
+            usage(std::cout);
+            std::exit(0);
+        } else if (arg == "-f" || arg == "--format") {
+            auto format = value();
+            if (!format) return std::nullopt;
+            if (*format == "ndjson") options.format = Format::Ndjson;
+            else if (*format == "counts") options.format = Format::Counts;
+            else if (*format == "binary") options.format = Format::Binary;
+            else if (*format == "none") options.format = Format::None;
+            else {
+                std::cerr << "db25tok: unknown format '" << *format << "'\n";
+                return std::nullopt;
+            }
+        } else if (arg == "-o" || arg == "--output") {
+            auto path = value();
+            if (!path) return std::nullopt;
+            options.output = *path;
+        } else if (arg == "--jobs" || arg.starts_with("-j")) {
+            // -j N, --jobs N or -jN
+            auto text = arg.size() > 2 && arg[1] == 'j' ? std::optional<std::string>(arg.substr(2)) : value();
+            if (!text) return std::nullopt;
+            auto jobs = parse_count("--jobs", *text, 0, MAX_JOBS);
+            if (!jobs) return std::nullopt;
+            options.jobs = static_cast<unsigned>(*jobs);
+        } else if (arg == "--chunk-size") {
+            auto text = value();
+            if (!text) return std::nullopt;
+            auto mb = parse_count(arg, *text, 1, MAX_CHUNK_MB);
+            if (!mb) return std::nullopt;
+            options.chunk_size = *mb << 20;
+        } else if (arg == "--no-comments") {
+            options.comments = false;
+        } else if (arg == "--compound") {
+            options.compound_keywords = true;
+        } else if (arg == "--psql") {
+            options.psql_script = true;
+        } else if (arg == "--dollar-quotes") {
+            options.dollar_quotes = true;
+        } else if (arg == "-s" || arg == "--summary") {
+            options.summary = true;
+        } else if (arg.size() > 1 && arg[0] == '-' && arg != "-") {
+            std::cerr << "db25tok: unknown option '" << arg << "'\n";
+            return std::nullopt;
+        } else {
+            options.inputs.push_back(arg);
+        }
+    }
+    if (options.inputs.empty()) {
+        options.inputs.push_back("-");
+    }
+    if (options.jobs == 0) {
+        options.jobs = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return options;
+}
+
+const char* token_type_name(TokenType type) {
+    switch (type) {
+        case TokenType::Unknown: return "Unknown";
+        case TokenType::Keyword: return "Keyword";
+        case TokenType::Identifier: return "Identifier";
+        case TokenType::Number: return "Number";
+        case TokenType::String: return "String";
+        case TokenType::Operator: return "Operator";
+        case TokenType::Delimiter: return "Delimiter";
+        case TokenType::Whitespace: return "Whitespace";
+        case TokenType::Comment: return "Comment";
+        case TokenType::EndOfFile: return "EOF";
+        case TokenType::LiteralList: return "LiteralList";
+        case TokenType::CopyData: return "CopyData";
+        case TokenType::MetaCommand: return "MetaCommand";
+        case TokenType::DollarString: return "DollarString";
+    }
+    return "Unknown";
+}
+
+void append_json_string(std::string& out, std::string_view text) {
+    static constexpr char HEX[] = "0123456789abcdef";
+    out += '"';
+    for (char c : text) {
+        auto ch = static_cast<uint8_t>(c);
+        if (ch == '"' || ch == '\\') {
+            out += '\\';
+            out += c;
+        } else if (ch == '\n') {
+            out += "\\n";
+        } else if (ch == '\r') {
+            out += "\\r";
+        } else if (ch == '\t') {
+            out += "\\t";
+        } else if (ch < 0x20) {
+            out += "\\u00";
+            out += HEX[ch >> 4];
+            out += HEX[ch & 0xF];
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+// One input; files are memory-mapped, stdin is mapped when it is a
+// regular file and read otherwise
+struct Input {
+    std::string name;
+    MappedFile mapped;
+    std::string buffer;
+
+    [[nodiscard]] std::string_view text() const noexcept {
+        return mapped.data() != nullptr ? mapped.text() : std::string_view(buffer);
+    }
+};
+
+Input open_input(const std::string& name) {
+    Input input;
+    input.name = name;
+    std::error_code ec;
+    if (name != "-") {
+        input.mapped = MappedFile(name);
+    } else if (fs::is_regular_file("/dev/stdin", ec)) {
+        input.name = "<stdin>";
+        input.mapped = MappedFile("/dev/stdin");
+    } else {
+        input.name = "<stdin>";
+        input.buffer.assign(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+    }
+    return input;
+}
+
+// A slice of one input that lexes independently
+struct Chunk {
+    size_t input;
+    size_t begin;
+    size_t end;
+    uint32_t line;      // Position of `begin` in the input
+    uint32_t column;
+    bool last;          // Last chunk of its input
+};
+
+struct StatementCount {
+    size_t offset;
+    uint32_t line;
+    size_t tokens;
+    size_t bytes;
+};
+
+struct ChunkResult {
+    std::string text;                       // ndjson
+    std::vector<StatementCount> statements; // counts
+    std::vector<Token> tokens;              // binary
+    size_t token_count = 0;
+};
+
+// Cuts inputs larger than the chunk size at statement boundaries
+std::vector<Chunk> plan_chunks(const std::vector<Input>& inputs, const Options& options) {
+    std::vector<Chunk> chunks;
+    StatementSplitter splitter;
+    splitter.set_psql_script(options.psql_script);
+    splitter.set_dollar_quotes(options.dollar_quotes);
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        std::string_view text = inputs[i].text();
+        std::vector<size_t> cuts;
+        if (options.jobs > 1 && text.size() > options.chunk_size) {
+            size_t next = options.chunk_size;
+            for (size_t boundary : splitter.find_boundaries(reinterpret_cast<const std::byte*>(text.data()),
+                                                            text.size())) {
+                if (boundary + 1 >= next && boundary + 1 < text.size()) {
+                    cuts.push_back(boundary + 1);
+                    next = boundary + 1 + options.chunk_size;
+                }
+            }
+        }
+        cuts.push_back(text.size());
+
+        size_t begin = 0;
+        uint32_t line = 1;
+        uint32_t column = 1;
+        for (size_t end : cuts) {
+            chunks.push_back({i, begin, end, line, column, end == text.size()});
+            // Start of the next chunk; the last chunk (often the only one) needs no scan
+            if (end < text.size()) {
+                std::string_view part = text.substr(begin, end - begin);
+                auto newlines = static_cast<uint32_t>(std::count(part.begin(), part.end(), '\n'));
+                if (newlines == 0) {
+                    column += static_cast<uint32_t>(part.size());
+                } else {
+                    line += newlines;
+                    column = static_cast<uint32_t>(part.size() - part.rfind('\n'));
+                }
+            }
+            begin = end;
+        }
+    }
+    return chunks;
+}
+
+template<typename Policy>
+ChunkResult process_chunk(const Input& input, const Chunk& chunk, const Options& options, bool name_files) {
+    ChunkResult result;
+    const char* base = input.text().data();
+    BasicSimdTokenizer<Policy> tokenizer(reinterpret_cast<const std::byte*>(base + chunk.begin),
+                                         chunk.end - chunk.begin);
+    tokenizer.set_compound_keywords(options.compound_keywords);
+    tokenizer.set_psql_script(options.psql_script);
+    tokenizer.set_dollar_quotes(options.dollar_quotes);
+
+    StatementCount statement{};
+    bool in_statement = false;
+    bool statement_ended = false;   // Closed unless COPY data follows
+    Token token;
+    while (tokenizer.next(token)) {
+        ++result.token_count;
+        // Positions are relative to the chunk
+        if (token.line == 1) {
+            token.column += chunk.column - 1;
+        }
+        token.line += chunk.line - 1;
+        size_t offset = static_cast<size_t>(token.value.data() - base);
+
+        switch (options.format) {
+            case Format::Ndjson: {
+                std::string& out = result.text;
+                out += '{';
+                if (name_files) {
+                    out += "\"file\":";
+                    append_json_string(out, input.name);
+                    out += ',';
+                }
+                out += "\"offset\":" + std::to_string(offset);
+                out += ",\"line\":" + std::to_string(token.line);
+                out += ",\"column\":" + std::to_string(token.column);
+                out += ",\"type\":\"";
+                out += token_type_name(token.type);
+                out += '"';
+                if (token.type == TokenType::Keyword) {
+                    out += ",\"keyword\":\"";
+                    out += keyword_name(token.keyword_id);
+                    out += '"';
+                }
+                out += ",\"value\":";
+                append_json_string(out, token.value);
+                out += "}\n";
+                break;
+            }
+            case Format::Counts:
+                if (statement_ended && token.type != TokenType::CopyData) {
+                    result.statements.push_back(statement);
+                    in_statement = false;
+                }
+                if (!in_statement) {
+                    statement = {offset, token.line, 0, 0};
+                    in_statement = true;
+                }
+                ++statement.tokens;
+                statement.bytes = offset + token.value.size() - statement.offset;
+                statement_ended = token.operator_kind() == OperatorKind::Semicolon ||
+                                  token.type == TokenType::MetaCommand;
+                break;
+            case Format::Binary:
+                result.tokens.push_back(token);
+                break;
+            case Format::None:
+                break;
+        }
+    }
+    if (in_statement) {
+        result.statements.push_back(statement);
+    }
+    return result;
+}
+
+fs::path binary_path(const Options& options, const Input& input, size_t input_count) {
+    if (!options.output.empty()) {
+        if (input_count == 1) {
+            return options.output;
+        }
+        return fs::path(options.output) / (fs::path(input.name).filename().string() + ".db25tok");
+    }
+    return input.name + ".db25tok";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    auto parsed = parse_options(argc, argv);
+    if (!parsed) {
+        usage(std::cerr);
+        return 2;
+    }
+    const Options& options = *parsed;
+    auto started = std::chrono::steady_clock::now();
+
+    std::vector<Input> inputs;
+    try {
+        for (const auto& name : options.inputs) {
+            inputs.push_back(open_input(name));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "db25tok: " << e.what() << "\n";
+        return 1;
+    }
+    if (options.format == Format::Binary) {
+        bool from_stdin = std::any_of(inputs.begin(), inputs.end(),
+                                      [](const Input& input) { return input.name == "<stdin>"; });
+        if (from_stdin && options.output.empty()) {
+            std::cerr << "db25tok: binary output from stdin needs --output\n";
+            return 2;
+        }
+        if (inputs.size() > 1 && !options.output.empty()) {
+            fs::create_directories(options.output);
+        }
+    }
+
+    std::ofstream file_out;
+    std::ostream* out = &std::cout;
+    if (!options.output.empty() && options.format != Format::Binary) {
+        file_out.open(options.output, std::ios::binary);
+        if (!file_out) {
+            std::cerr << "db25tok: cannot write " << options.output << "\n";
+            return 1;
+        }
+        out = &file_out;
+    }
+    std::ios::sync_with_stdio(false);
+
+    std::vector<Chunk> chunks = plan_chunks(inputs, options);
+    const bool name_files = inputs.size() > 1;
+    auto process = [&](const Chunk& chunk) {
+        return options.comments
+            ? process_chunk<TokenizerPolicy<true>>(inputs[chunk.input], chunk, options, name_files)
+            : process_chunk<TokenizerPolicy<false>>(inputs[chunk.input], chunk, options, name_files);
+    };
+
+    // Waves of chunks: workers lex in parallel, output is written in order
+    size_t bytes = 0, tokens = 0, statements = 0;
+    std::vector<Token> file_tokens;
+    const size_t wave = static_cast<size_t>(options.jobs) * 2;
+    std::vector<ChunkResult> results;
+    for (size_t first = 0; first < chunks.size(); first += wave) {
+        size_t count = std::min(wave, chunks.size() - first);
+        results.assign(count, {});
+        std::atomic<size_t> next{0};
+        auto work = [&] {
+            for (size_t i; (i = next.fetch_add(1)) < count;) {
+                results[i] = process(chunks[first + i]);
+            }
+        };
+        {
+            std::vector<std::jthread> workers;
+            for (size_t w = 1; w < std::min<size_t>(options.jobs, count); ++w) {
+                workers.emplace_back(work);
+            }
+            work();
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            const Chunk& chunk = chunks[first + i];
+            const Input& input = inputs[chunk.input];
+            ChunkResult& result = results[i];
+            bytes += chunk.end - chunk.begin;
+            tokens += result.token_count;
+
+            if (options.format == Format::Ndjson) {
+                out->write(result.text.data(), static_cast<std::streamsize>(result.text.size()));
+            } else if (options.format == Format::Counts) {
+                for (const auto& statement : result.statements) {
+                    std::string line = "{";
+                    if (name_files) {
+                        line += "\"file\":";
+                        append_json_string(line, input.name);
+                        line += ',';
+                    }
+                    line += "\"statement\":" + std::to_string(statements++);
+                    line += ",\"offset\":" + std::to_string(statement.offset);
+                    line += ",\"line\":" + std::to_string(statement.line);
+                    line += ",\"tokens\":" + std::to_string(statement.tokens);
+                    line += ",\"bytes\":" + std::to_string(statement.bytes) + "}\n";
+                    *out << line;
+                }
+            } else if (options.format == Format::Binary) {
+                file_tokens.insert(file_tokens.end(), result.tokens.begin(), result.tokens.end());
+                if (chunk.last) {
+                    fs::path path = binary_path(options, input, inputs.size());
+                    try {
+                        write_token_cache(path, reinterpret_cast<const std::byte*>(input.text().data()),
+                                          input.text().size(), file_tokens);
+                    } catch (const std::exception& e) {
+                        std::cerr << "db25tok: " << e.what() << "\n";
+                        return 1;
+                    }
+                    file_tokens.clear();
+                }
+            }
+            if (options.format != Format::Counts) {
+                statements += result.statements.size();
+            }
+        }
+    }
+    out->flush();
+
+    if (options.summary) {
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+        char line[128];
+        std::cerr << "Inputs:      " << inputs.size() << " (" << chunks.size() << " chunks, "
+                  << options.jobs << " workers)\n";
+        std::snprintf(line, sizeof(line), "Bytes:       %zu (%.2f MB)\n", bytes, bytes / (1024.0 * 1024.0));
+        std::cerr << line;
+        std::cerr << "Tokens:      " << tokens << "\n";
+        if (options.format == Format::Counts) {
+            std::cerr << "Statements:  " << statements << "\n";
+        }
+        std::cerr << "SIMD level:  " << CpuDetection::level_name() << "\n";
+        std::snprintf(line, sizeof(line), "Elapsed:     %.3f ms\n", seconds * 1e3);
+        std::cerr << line;
+        std::snprintf(line, sizeof(line), "Throughput:  %.1f MB/s, %.2f M tokens/s\n",
+                      seconds > 0 ? bytes / seconds / (1024.0 * 1024.0) : 0.0,
+                      seconds > 0 ? tokens / seconds / 1e6 : 0.0);
+        std::cerr << line;
+    }
+    return out->good() ? 0 : 1;
+}
@@ -20,8 +20,11 @@
 #include <algorithm>
 #include <iomanip>
 #include <string>
+#include <string_view>
 #include <cctype>
 #include <map>
+#include <array>
+#include <cstdint>
 
 struct KeywordInfo {
     std::string keyword;
@@ -40,6 +43,19 @@ private:
     std::set<std::string> reserved_keywords;
     std::set<std::string> contextual_keywords;
     
+    // Parser-facing categories, emitted as the KEYWORD_ATTRIBUTES bitset
+    struct AttributeSet {
+        const char* name;
+        const char* description;
+        std::set<std::string> keywords;
+    };
+    std::vector<AttributeSet> attribute_sets;
+    
+    // Multi-word keywords the tokenizer can fuse into one token; IDs follow
+    // the single keywords in this order
+    std::vector<std::vector<std::string>> compound_keywords;
+    static constexpr size_t COMPOUND_MAX_PARTS = 4;
+    
     static constexpr uint32_t FNV1A_PRIME = 0x01000193;
     static constexpr uint32_t FNV1A_OFFSET = 0x811C9DC5;
     
@@ -53,7 +69,199 @@ private:
         return hash;
     }
     
+    // Keywords in Keyword enum order (enum value = index + 1)
+    std::vector<KeywordInfo> sorted_keywords() const {
+        // Prepare keyword data (excluding UNKNOWN which is predefined)
+        std::vector<KeywordInfo> keywords;
+        for (const auto& kw : all_keywords) {
+            if (kw != "UNKNOWN") {  // Skip UNKNOWN - it's predefined as enum value 0
+                keywords.push_back({
+                    kw,
+                    kw.length(),
+                    hash_keyword(kw),
+                    reserved_keywords.count(kw) > 0
+                });
+            }
+        }
+        
+        // Sort by length first, then alphabetically for binary search optimization
+        std::sort(keywords.begin(), keywords.end(), [](const auto& a, const auto& b) {
+            if (a.length != b.length) return a.length < b.length;
+            return a.keyword < b.keyword;
+        });
+        return keywords;
+    }
+    
+    static std::string enum_name_of(const std::string& keyword) {
+        if (keyword == "NULL") return "KW_NULL";
+        if (keyword == "TRUE") return "KW_TRUE";
+        if (keyword == "FALSE") return "KW_FALSE";
+        if (keyword == "DEFAULT") return "KW_DEFAULT";
+        if (keyword == "CASE") return "KW_CASE";
+        return keyword;
+    }
+    
+    static std::string join_words(const std::vector<std::string>& words, const char* separator) {
+        std::string joined;
+        for (const auto& word : words) {
+            if (!joined.empty()) joined += separator;
+            joined += word;
+        }
+        return joined;
+    }
+    
+    uint16_t attribute_bits(const std::string& keyword) const {
+        uint16_t bits = 0;
+        for (size_t bit = 0; bit < attribute_sets.size(); ++bit) {
+            if (attribute_sets[bit].keywords.count(keyword) > 0) {
+                bits |= static_cast<uint16_t>(1u << bit);
+            }
+        }
+        return bits;
+    }
+    
+    uint16_t attribute_bit(std::string_view name) const {
+        for (size_t bit = 0; bit < attribute_sets.size(); ++bit) {
+            if (attribute_sets[bit].name == name) {
+                return static_cast<uint16_t>(1u << bit);
+            }
+        }
+        return 0;
+    }
+    
+    // A compound keyword is never an identifier and plays its first word's
+    // role; it is a join operator if any of its words is
+    uint16_t compound_attribute_bits(const std::vector<std::string>& words) const {
+        const uint16_t reserved = attribute_bit("RESERVED"), contextual = attribute_bit("CONTEXTUAL");
+        const uint16_t join = attribute_bit("JOIN"), head = attribute_bit("COMPOUND_HEAD");
+        uint16_t bits = static_cast<uint16_t>((attribute_bits(words[0]) & ~(contextual | head)) | reserved);
+        for (const auto& word : words) {
+            bits |= attribute_bits(word) & join;
+        }
+        return bits;
+    }
+    
+    // Compound keyword table and the matcher the tokenizer's fusion stage uses
+    void generate_compounds(std::ofstream& out) const {
+        if (compound_keywords.empty()) {
+            return;
+        }
+        out << "// Multi-word keywords, fused into one Keyword token (spanning any\n";
+        out << "// whitespace and comments between the words) when the tokenizer's\n";
+        out << "// compound stage is enabled. IDs follow the single keywords.\n";
+        out << "inline constexpr size_t COMPOUND_KEYWORD_MAX_PARTS = " << COMPOUND_MAX_PARTS << ";\n";
+        out << "inline constexpr Keyword FIRST_COMPOUND_KEYWORD = Keyword::"
+            << join_words(compound_keywords.front(), "_") << ";\n\n";
+        out << "struct CompoundKeywordEntry {\n";
+        out << "    std::string_view text;      // Canonical spelling, words separated by one space\n";
+        out << "    Keyword id;\n";
+        out << "    uint8_t part_count;\n";
+        out << "    std::array<Keyword, COMPOUND_KEYWORD_MAX_PARTS> parts;\n";
+        out << "};\n\n";
+        out << "inline constexpr std::array<CompoundKeywordEntry, " << compound_keywords.size()
+            << "> COMPOUND_KEYWORDS = {{\n";
+        for (size_t i = 0; i < compound_keywords.size(); ++i) {
+            const auto& words = compound_keywords[i];
+            out << "    {\"" << join_words(words, " ") << "\", Keyword::" << join_words(words, "_")
+                << ", " << words.size() << ", {";
+            for (size_t w = 0; w < words.size(); ++w) {
+                out << (w ? ", " : "") << "Keyword::" << enum_name_of(words[w]);
+            }
+            out << "}}" << (i < compound_keywords.size() - 1 ? "," : "") << "\n";
+        }
+        out << "}};\n\n";
+        out << "[[nodiscard]] constexpr bool is_compound_keyword(Keyword kw) noexcept {\n";
+        out << "    return static_cast<uint16_t>(kw) >= static_cast<uint16_t>(FIRST_COMPOUND_KEYWORD);\n";
+        out << "}\n\n";
+        out << "struct CompoundMatch {\n";
+        out << "    Keyword keyword;            // Compound spelled exactly by the words (UNKNOWN if none)\n";
+        out << "    bool extensible;            // A longer compound starts with the words\n";
+        out << "};\n\n";
+        out << "[[nodiscard]] constexpr CompoundMatch match_compound_keyword(const Keyword* parts, size_t count) noexcept {\n";
+        out << "    CompoundMatch match{Keyword::UNKNOWN, false};\n";
+        out << "    for (const auto& entry : COMPOUND_KEYWORDS) {\n";
+        out << "        if (entry.part_count < count || !std::equal(parts, parts + count, entry.parts.begin())) {\n";
+        out << "            continue;\n";
+        out << "        }\n";
+        out << "        if (entry.part_count == count) {\n";
+        out << "            match.keyword = entry.id;\n";
+        out << "        } else {\n";
+        out << "            match.extensible = true;\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "    return match;\n";
+        out << "}\n\n";
+    }
+    
+    // Per-Keyword attribute bitset, indexed by the enum value
+    void generate_attributes(std::ofstream& out, const std::vector<KeywordInfo>& keywords) {
+        out << "// Keyword attribute bits (KEYWORD_ATTRIBUTES)\n";
+        out << "struct KeywordAttr {\n";
+        out << "    enum : uint16_t {\n";
+        for (size_t bit = 0; bit < attribute_sets.size(); ++bit) {
+            std::string name = attribute_sets[bit].name;
+            out << "        " << name << std::string(16 - name.size(), ' ')
+                << "= 1 << " << bit << ",";
+            out << std::string(bit < 10 ? 3 : 2, ' ') << "// " << attribute_sets[bit].description << "\n";
+        }
+        out << "    };\n";
+        out << "};\n\n";
+        
+        out << "// Indexed by Keyword; UNKNOWN (non-keyword tokens) has no bits\n";
+        size_t total = keywords.size() + compound_keywords.size();
+        out << "inline constexpr std::array<uint16_t, " << total + 1 << "> KEYWORD_ATTRIBUTES = {{\n";
+        out << "    0x0000,  // UNKNOWN\n";
+        for (size_t i = 0; i < total; ++i) {
+            bool compound = i >= keywords.size();
+            uint16_t bits = compound ? compound_attribute_bits(compound_keywords[i - keywords.size()])
+                                     : attribute_bits(keywords[i].keyword);
+            out << "    0x" << std::hex << std::setw(4) << std::setfill('0') << bits
+                << std::dec << std::setfill(' ');
+            if (i < total - 1) out << ",";
+            else out << " ";
+            out << "  // " << (compound ? join_words(compound_keywords[i - keywords.size()], "_")
+                                        : enum_name_of(keywords[i].keyword)) << "\n";
+        }
+        out << "}};\n\n";
+        
+        out << "[[nodiscard]] constexpr uint16_t keyword_attributes(Keyword kw) noexcept {\n";
+        out << "    return KEYWORD_ATTRIBUTES[static_cast<size_t>(kw)];\n";
+        out << "}\n\n";
+        out << "[[nodiscard]] constexpr bool keyword_has(Keyword kw, uint16_t attributes) noexcept {\n";
+        out << "    return (KEYWORD_ATTRIBUTES[static_cast<size_t>(kw)] & attributes) != 0;\n";
+        out << "}\n\n";
+    }
+    
 public:
+    // Keyword list of a generated keywords.hpp (its KEYWORDS table), for
+    // building the lexer DFA without the grammar
+    bool load_keywords_header(const std::string& header_file) {
+        std::ifstream file(header_file);
+        if (!file) {
+            std::cerr << "Cannot open keywords header: " << header_file << std::endl;
+            return false;
+        }
+        
+        std::string line;
+        std::regex entry_regex("^\\s*\\{\"([A-Z_]+)\", \\d+, 0x[0-9a-f]+, Keyword::\\w+, (true|false)\\},?$");
+        std::smatch match;
+        while (std::getline(file, line)) {
+            if (std::regex_match(line, match, entry_regex)) {
+                all_keywords.insert(match[1]);
+                if (match[2] == "true") {
+                    reserved_keywords.insert(match[1]);
+                }
+            }
+        }
+        if (all_keywords.empty()) {
+            std::cerr << "No KEYWORDS entries in " << header_file << std::endl;
+            return false;
+        }
+        
+        std::cout << "Loaded " << all_keywords.size() << " keywords from " << header_file << std::endl;
+        return true;
+    }
+    
     bool extract_from_ebnf(const std::string& ebnf_file) {
         std::ifstream file(ebnf_file);
         if (!file) {
@@ -103,6 +311,58 @@ public:
             "ILIKE", "UNKNOWN", "PIVOT", "UNPIVOT", "LATERAL"
         };
         
+        // Attribute bits in declaration order; RESERVED and CONTEXTUAL mirror
+        // the sets above
+        attribute_sets = {
+            {"RESERVED", "Never an identifier", reserved_keywords},
+            {"CONTEXTUAL", "Identifier outside its clause", contextual_keywords},
+            {"TYPE_NAME", "Starts or continues a data type", {
+                "INT", "INTEGER", "SMALLINT", "BIGINT", "REAL", "FLOAT", "DOUBLE",
+                "PRECISION", "DECIMAL", "NUMERIC", "BOOL", "BOOLEAN", "CHAR",
+                "CHARACTER", "VARCHAR", "VARYING", "TEXT", "BLOB", "BYTEA", "BINARY",
+                "DATE", "TIME", "TIMESTAMP", "INTERVAL", "JSON", "JSONB"
+            }},
+            {"CLAUSE_START", "Begins a clause of a statement", {
+                "SELECT", "FROM", "WHERE", "GROUP", "HAVING", "WINDOW", "ORDER",
+                "LIMIT", "OFFSET", "FETCH", "UNION", "INTERSECT", "EXCEPT",
+                "VALUES", "SET", "USING", "ON", "RETURNING", "INTO", "WITH"
+            }},
+            {"STATEMENT_START", "Begins a statement", {
+                "SELECT", "INSERT", "UPDATE", "DELETE", "WITH", "VALUES", "CREATE",
+                "ALTER", "DROP", "BEGIN", "COMMIT", "ROLLBACK", "SAVEPOINT", "RELEASE",
+                "EXPLAIN", "ANALYZE", "VACUUM", "REINDEX", "PRAGMA", "ATTACH", "DETACH"
+            }},
+            {"JOIN", "Part of a join operator", {
+                "JOIN", "INNER", "LEFT", "RIGHT", "FULL", "OUTER", "CROSS",
+                "NATURAL", "LATERAL"
+            }},
+            {"FUNCTION", "Function-call syntax (name followed by '(')", {
+                "CAST", "EXTRACT", "EXISTS", "GROUPING", "CUBE", "ROLLUP", "ARRAY"
+            }},
+            {"OPERATOR", "Infix or prefix word operator", {
+                "AND", "OR", "NOT", "IN", "IS", "LIKE", "ILIKE", "BETWEEN", "ESCAPE"
+            }},
+            {"LITERAL", "Literal value", {"NULL", "TRUE", "FALSE"}},
+        };
+        
+        compound_keywords = {
+            {"ORDER", "BY"}, {"GROUP", "BY"}, {"PARTITION", "BY"},
+            {"UNION", "ALL"}, {"INTERSECT", "ALL"}, {"EXCEPT", "ALL"},
+            {"INNER", "JOIN"}, {"CROSS", "JOIN"}, {"NATURAL", "JOIN"},
+            {"LEFT", "JOIN"}, {"LEFT", "OUTER", "JOIN"},
+            {"RIGHT", "JOIN"}, {"RIGHT", "OUTER", "JOIN"},
+            {"FULL", "JOIN"}, {"FULL", "OUTER", "JOIN"},
+            {"IS", "NULL"}, {"IS", "NOT", "NULL"},
+            {"IS", "DISTINCT", "FROM"}, {"IS", "NOT", "DISTINCT", "FROM"},
+            {"NOT", "NULL"}, {"NOT", "IN"}, {"NOT", "LIKE"}, {"NOT", "ILIKE"},
+            {"NOT", "BETWEEN"}, {"NOT", "EXISTS"},
+            {"PRIMARY", "KEY"}, {"FOREIGN", "KEY"},
+            {"INSERT", "INTO"}, {"DELETE", "FROM"},
+            {"ON", "CONFLICT"}, {"DO", "NOTHING"},
+            {"NULLS", "FIRST"}, {"NULLS", "LAST"},
+            {"WITH", "RECURSIVE"}
+        };
+        
         while (std::getline(file, line)) {
             // Skip comments
             if (line.empty() || (line.size() > 1 && line[0] == '(' && line[1] == '*')) {
@@ -138,6 +398,19 @@ public:
         all_keywords.insert(reserved_keywords.begin(), reserved_keywords.end());
         all_keywords.insert(contextual_keywords.begin(), contextual_keywords.end());
         
+        // Compounds need every word to be a keyword; COMPOUND_HEAD marks the
+        // words that can start one
+        std::erase_if(compound_keywords, [&](const auto& words) {
+            return words.size() > COMPOUND_MAX_PARTS ||
+                   std::any_of(words.begin(), words.end(),
+                               [&](const auto& word) { return all_keywords.count(word) == 0; });
+        });
+        AttributeSet heads{"COMPOUND_HEAD", "First word of a COMPOUND_KEYWORDS entry", {}};
+        for (const auto& words : compound_keywords) {
+            heads.keywords.insert(words[0]);
+        }
+        attribute_sets.push_back(std::move(heads));
+        
         std::cout << "Extracted " << all_keywords.size() << " keywords from EBNF" << std::endl;
         std::cout << "  Reserved: " << reserved_keywords.size() << std::endl;
         std::cout << "  Contextual: " << contextual_keywords.size() << std::endl;
@@ -152,29 +425,28 @@ public:
             return;
         }
         
-        // Prepare keyword data (excluding UNKNOWN which is predefined)
-        std::vector<KeywordInfo> keywords;
-        for (const auto& kw : all_keywords) {
-            if (kw != "UNKNOWN") {  // Skip UNKNOWN - it's predefined as enum value 0
-                keywords.push_back({
-                    kw,
-                    kw.length(),
-                    hash_keyword(kw),
-                    reserved_keywords.count(kw) > 0
-                });
-            }
-        }
-        
-        // Sort by length first, then alphabetically for binary search optimization
-        std::sort(keywords.begin(), keywords.end(), [](const auto& a, const auto& b) {
-            if (a.length != b.length) return a.length < b.length;
-            return a.keyword < b.keyword;
-        });
+        std::vector<KeywordInfo> keywords = sorted_keywords();
         
         // Generate header file
-        out << "#pragma once\n";
+        out << "/*\n";
+        out << " * Copyright (c) 2024 Chiradip Mandal\n";
+        out << " * Author: Chiradip Mandal\n";
+        out << " * Organization: Space-RF.org\n";
+        out << " * \n";
+        out << " * This file is part of DB25 SQL Tokenizer.\n";
+        out << " * \n";
+        out << " * Licensed under the MIT License. See LICENSE file for details.\n";
+        out << " */\n\n";
+        out << "#pragma once\n\n";
+        out << "// ============================================================================\n";
+        out << "// PROTECTED FILE - AUTO-GENERATED - DO NOT MODIFY\n";
+        out << "// ============================================================================\n";
         out << "// Auto-generated from DB25_SQL_GRAMMAR.ebnf\n";
-        out << "// DO NOT EDIT MANUALLY\n\n";
+        out << "// This file is automatically regenerated when the grammar changes.\n";
+        out << "// \n";
+        out << "// MODIFICATION RESTRICTION: Never edit manually. Use extract_keywords tool.\n";
+        out << "// To update: ./extract_keywords ../grammar/DB25_SQL_GRAMMAR.ebnf ../include/keywords.hpp\n";
+        out << "// ============================================================================\n\n";
         out << "#include <string_view>\n";
         out << "#include <array>\n";
         out << "#include <cstdint>\n";
@@ -186,15 +458,15 @@ public:
         out << "    UNKNOWN = 0,\n";
         for (size_t i = 0; i < keywords.size(); ++i) {
             // Handle C++ reserved words
-            std::string enum_name = keywords[i].keyword;
-            if (enum_name == "NULL") enum_name = "KW_NULL";
-            if (enum_name == "TRUE") enum_name = "KW_TRUE";
-            if (enum_name == "FALSE") enum_name = "KW_FALSE";
-            if (enum_name == "DEFAULT") enum_name = "KW_DEFAULT";
-            if (enum_name == "CASE") enum_name = "KW_CASE";
+            std::string enum_name = enum_name_of(keywords[i].keyword);
             
             out << "    " << enum_name << " = " << (i + 1);
-            if (i < keywords.size() - 1) out << ",";
+            if (i < keywords.size() - 1 || !compound_keywords.empty()) out << ",";
+            out << "\n";
+        }
+        for (size_t i = 0; i < compound_keywords.size(); ++i) {
+            out << "    " << join_words(compound_keywords[i], "_") << " = " << (keywords.size() + i + 1);
+            if (i < compound_keywords.size() - 1) out << ",";
             out << "\n";
         }
         out << "};\n\n";
@@ -213,12 +485,7 @@ public:
             const auto& kw = keywords[i];
             
             // Handle C++ reserved words for enum reference
-            std::string enum_name = kw.keyword;
-            if (enum_name == "NULL") enum_name = "KW_NULL";
-            if (enum_name == "TRUE") enum_name = "KW_TRUE";
-            if (enum_name == "FALSE") enum_name = "KW_FALSE";
-            if (enum_name == "DEFAULT") enum_name = "KW_DEFAULT";
-            if (enum_name == "CASE") enum_name = "KW_CASE";
+            std::string enum_name = enum_name_of(kw.keyword);
             
             out << "    {\"" << kw.keyword << "\", " 
                 << static_cast<int>(kw.length) << ", "
@@ -309,6 +576,8 @@ public:
         out << "    return false;\n";
         out << "}\n\n";
         
+        generate_compounds(out);
+        
         out << "// Keyword name lookup\n";
         out << "[[nodiscard]] inline std::string_view keyword_name(Keyword kw) noexcept {\n";
         out << "    if (kw == Keyword::UNKNOWN) return \"UNKNOWN\";\n";
@@ -316,18 +585,221 @@ public:
         out << "    if (idx < KEYWORDS.size()) {\n";
         out << "        return KEYWORDS[idx].text;\n";
         out << "    }\n";
+        out << "    idx -= KEYWORDS.size();\n";
+        out << "    if (idx < COMPOUND_KEYWORDS.size()) {\n";
+        out << "        return COMPOUND_KEYWORDS[idx].text;\n";
+        out << "    }\n";
         out << "    return \"INVALID\";\n";
         out << "}\n\n";
         
+        generate_attributes(out, keywords);
+        
+        out << "}  // namespace db25\n";
+        
+        std::cout << "Generated " << output_file << " with " << keywords.size() << " keywords and "
+                  << compound_keywords.size() << " compound keywords" << std::endl;
+    }
+    
+    // Lexer DFA: a keyword trie whose missing edges fall into a generic
+    // identifier state, so one walk yields both the word's length and its
+    // Keyword. Rows are padded to 32 uint16_t entries, one cache line each.
+    bool generate_lexer_dfa(const std::string& output_file) const {
+        constexpr int LETTERS = 26;
+        constexpr int CLASS_DIGIT = 26;
+        constexpr int CLASS_UNDERSCORE = 27;
+        constexpr int CLASS_EXIT = 28;
+        constexpr int ROW_STRIDE = 32;
+        constexpr int STATE_DEAD = 0;
+        constexpr int STATE_START = 1;
+        constexpr int STATE_IDENTIFIER = 2;
+        
+        std::vector<KeywordInfo> keywords = sorted_keywords();
+        
+        // Trie over the keywords; node 0 is the start state
+        std::vector<std::array<int, LETTERS>> children(1);
+        std::vector<size_t> accepts(1, 0);
+        std::vector<std::string> prefixes(1);
+        children[0].fill(-1);
+        for (size_t i = 0; i < keywords.size(); ++i) {
+            int node = 0;
+            for (char c : keywords[i].keyword) {
+                if (c < 'A' || c > 'Z') {
+                    std::cerr << "Keyword " << keywords[i].keyword << " is not [A-Z]+; cannot build the lexer DFA" << std::endl;
+                    return false;
+                }
+                if (children[node][c - 'A'] < 0) {
+                    children[node][c - 'A'] = static_cast<int>(children.size());
+                    children.emplace_back();
+                    children.back().fill(-1);
+                    accepts.push_back(0);
+                    prefixes.push_back(prefixes[node] + c);
+                }
+                node = children[node][c - 'A'];
+            }
+            accepts[node] = i + 1;
+        }
+        
+        auto state_of = [](int node) { return node == 0 ? STATE_START : node + 2; };
+        const size_t state_count = children.size() + 2;
+        
+        std::vector<std::array<uint16_t, ROW_STRIDE>> rows(state_count);
+        std::vector<uint16_t> accept_row(state_count, 0);
+        for (auto& row : rows) row.fill(STATE_DEAD);
+        for (int c = 0; c < LETTERS; ++c) rows[STATE_IDENTIFIER][c] = STATE_IDENTIFIER;
+        rows[STATE_IDENTIFIER][CLASS_DIGIT] = STATE_IDENTIFIER;
+        rows[STATE_IDENTIFIER][CLASS_UNDERSCORE] = STATE_IDENTIFIER;
+        for (size_t node = 0; node < children.size(); ++node) {
+            auto& row = rows[state_of(static_cast<int>(node))];
+            for (int c = 0; c < LETTERS; ++c) {
+                int child = children[node][c];
+                row[c] = static_cast<uint16_t>(child < 0 ? STATE_IDENTIFIER : state_of(child));
+            }
+            // Words cannot start with a digit
+            row[CLASS_DIGIT] = node == 0 ? STATE_DEAD : STATE_IDENTIFIER;
+            row[CLASS_UNDERSCORE] = STATE_IDENTIFIER;
+            accept_row[state_of(static_cast<int>(node))] = static_cast<uint16_t>(accepts[node]);
+        }
+        
+        std::ofstream out(output_file);
+        if (!out) {
+            std::cerr << "Cannot create output file: " << output_file << std::endl;
+            return false;
+        }
+        
+        out << "/*\n";
+        out << " * Copyright (c) 2024 Chiradip Mandal\n";
+        out << " * Author: Chiradip Mandal\n";
+        out << " * Organization: Space-RF.org\n";
+        out << " * \n";
+        out << " * This file is part of DB25 SQL Tokenizer.\n";
+        out << " * \n";
+        out << " * Licensed under the MIT License. See LICENSE file for details.\n";
+        out << " */\n\n";
+        out << "#pragma once\n\n";
+        out << "// ============================================================================\n";
+        out << "// AUTO-GENERATED - DO NOT MODIFY\n";
+        out << "// ============================================================================\n";
+        out << "// Lexer DFA generated by tools/extract_keywords.cpp. Sources of truth: the\n";
+        out << "// KEYWORDS table in keywords.hpp (the word trie and accepted Keyword IDs)\n";
+        out << "// and the lexical classes hard-coded in the generator (LEX_START and\n";
+        out << "// DFA_BYTE_CLASS). No grammar file is involved.\n";
+        out << "// To update: ./extract_keywords --dfa ../include/keywords.hpp ../include/lexer_dfa.hpp\n";
+        out << "// (or the regenerate_lexer_dfa CMake target)\n";
+        out << "// ============================================================================\n\n";
+        out << "#include \"keywords.hpp\"\n";
+        out << "#include <array>\n";
+        out << "#include <cstddef>\n";
+        out << "#include <cstdint>\n\n";
+        out << "namespace db25 {\n\n";
+        
+        // Start-byte dispatch
+        out << "// Scanner selected by the first byte of a token\n";
+        out << "enum class LexStart : uint8_t {\n";
+        out << "    Operator,   // Operators, delimiters and anything unclassified\n";
+        out << "    Word,       // [A-Za-z_]: identifier or keyword\n";
+        out << "    Number,     // [0-9]\n";
+        out << "    Quote,      // ' or \"\n";
+        out << "    Dash,       // '-': line comment or operator\n";
+        out << "    Slash,      // '/': block comment or operator\n";
+        out << "    NonAscii    // UTF-8 lead or invalid byte\n";
+        out << "};\n\n";
+        
+        auto start_of = [](int byte) {
+            if ((byte >= 'A' && byte <= 'Z') || (byte >= 'a' && byte <= 'z') || byte == '_') return 1;
+            if (byte >= '0' && byte <= '9') return 2;
+            if (byte == '\'' || byte == '"') return 3;
+            if (byte == '-') return 4;
+            if (byte == '/') return 5;
+            if (byte >= 0x80) return 6;
+            return 0;
+        };
+        auto class_of = [](int byte) {
+            if (byte >= 'A' && byte <= 'Z') return byte - 'A';
+            if (byte >= 'a' && byte <= 'z') return byte - 'a';
+            if (byte >= '0' && byte <= '9') return CLASS_DIGIT;
+            if (byte == '_') return CLASS_UNDERSCORE;
+            return CLASS_EXIT;
+        };
+        auto emit_bytes = [&](const char* type, const char* name, auto value_of) {
+            out << "inline constexpr std::array<" << type << ", 256> " << name << " = {{\n";
+            for (int byte = 0; byte < 256; byte += 16) {
+                out << "   ";
+                for (int i = byte; i < byte + 16; ++i) {
+                    out << " " << value_of(i) << (i < 255 ? "," : "");
+                }
+                out << "\n";
+            }
+            out << "}};\n\n";
+        };
+        emit_bytes("uint8_t", "LEX_START", start_of);
+        
+        out << "// Word DFA: byte classes are A-Z (case-folded), digit, '_', exit\n";
+        out << "inline constexpr size_t DFA_CLASS_STRIDE = " << ROW_STRIDE << ";\n";
+        out << "inline constexpr uint16_t DFA_DEAD = " << STATE_DEAD << ";\n";
+        out << "inline constexpr uint16_t DFA_START = " << STATE_START << ";\n";
+        out << "inline constexpr uint16_t DFA_IDENTIFIER = " << STATE_IDENTIFIER << ";\n";
+        out << "inline constexpr size_t DFA_STATE_COUNT = " << state_count << ";\n\n";
+        emit_bytes("uint8_t", "DFA_BYTE_CLASS", class_of);
+        
+        out << "alignas(64) inline constexpr uint16_t DFA_TRANSITIONS[DFA_STATE_COUNT][DFA_CLASS_STRIDE] = {\n";
+        for (size_t state = 0; state < state_count; ++state) {
+            out << "    {";
+            for (int c = 0; c < ROW_STRIDE; ++c) {
+                out << rows[state][c] << (c + 1 < ROW_STRIDE ? ", " : "");
+            }
+            out << "}" << (state + 1 < state_count ? "," : "") << "  // ";
+            if (state == STATE_DEAD) out << "dead";
+            else if (state == STATE_START) out << "start";
+            else if (state == STATE_IDENTIFIER) out << "identifier";
+            else out << prefixes[state - 2];
+            out << "\n";
+        }
+        out << "};\n\n";
+        
+        out << "// Keyword accepted in each state (UNKNOWN = plain identifier)\n";
+        out << "inline constexpr std::array<uint16_t, DFA_STATE_COUNT> DFA_KEYWORD = {{\n";
+        for (size_t state = 0; state < state_count; state += 16) {
+            out << "   ";
+            for (size_t i = state; i < std::min(state + 16, state_count); ++i) {
+                out << " " << accept_row[i] << (i + 1 < state_count ? "," : "");
+            }
+            out << "\n";
+        }
+        out << "}};\n\n";
+        
+        out << "struct DfaWord {\n";
+        out << "    size_t length;      // Bytes of [A-Za-z0-9_] consumed\n";
+        out << "    Keyword keyword;    // Keyword::UNKNOWN for identifiers\n";
+        out << "};\n\n";
+        out << "// Scans an identifier-shaped word at `p`, resolving its keyword in the same walk\n";
+        out << "[[nodiscard]] inline DfaWord dfa_scan_word(const uint8_t* p, size_t size) noexcept {\n";
+        out << "    uint32_t state = DFA_START;\n";
+        out << "    size_t i = 0;\n";
+        out << "    for (; i < size; ++i) {\n";
+        out << "        uint32_t next = DFA_TRANSITIONS[state][DFA_BYTE_CLASS[p[i]]];\n";
+        out << "        if (next == DFA_DEAD) {\n";
+        out << "            break;\n";
+        out << "        }\n";
+        out << "        state = next;\n";
+        out << "    }\n";
+        out << "    return {i, static_cast<Keyword>(DFA_KEYWORD[state])};\n";
+        out << "}\n\n";
+        
         out << "}  // namespace db25\n";
         
-        std::cout << "Generated " << output_file << " with " << keywords.size() << " keywords" << std::endl;
+        std::cout << "Generated " << output_file << " with " << state_count << " DFA states" << std::endl;
+        return true;
     }
 };
 
 int main(int argc, char* argv[]) {
-    if (argc != 3) {
-        std::cerr << "Usage: " << argv[0] << " <grammar.ebnf> <output.hpp>" << std::endl;
+    if (argc == 4 && std::string_view(argv[1]) == "--dfa") {
+        EBNFKeywordExtractor extractor;
+        return extractor.load_keywords_header(argv[2]) && extractor.generate_lexer_dfa(argv[3]) ? 0 : 1;
+    }
+    if (argc != 3 && argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <grammar.ebnf> <output.hpp> [lexer_dfa.hpp]\n"
+                  << "       " << argv[0] << " --dfa <keywords.hpp> <lexer_dfa.hpp>" << std::endl;
         return 1;
     }
     
@@ -342,5 +814,9 @@ int main(int argc, char* argv[]) {
     
     extractor.generate_header(output_file);
     
+    if (argc == 4 && !extractor.generate_lexer_dfa(argv[3])) {
+        return 1;
+    }
+    
     return 0;
 }
\ No newline at end of file